@@ -3,10 +3,14 @@
 
 ////////////////////////////////////////////////////////////////////////////////
 // Standard Headers
+#include <array>
+#include <cstdint>
+#include <limits>
 #include <map>
 #include <set>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 ////////////////////////////////////////////////////////////////////////////////
 // User Defined Headers
@@ -15,11 +19,39 @@
 
 namespace speller {
 
+/// Index of a letter in the alphabet, shared by its lowercase and uppercase forms
+using LetterId = std::uint8_t;
+
 class Alphabet {
 public:
+    /// Identifier of characters that do not exist in the alphabet
+    static constexpr LetterId foreign_letter_id = std::numeric_limits<LetterId>::max();
+
+    /// How strings are split into letters, decided by the sizes of the letters
+    enum class Encoding {
+        /// Every letter is a single character, so every character is a letter
+        single_byte,
+        /// Every letter is a single UTF-8 encoded code point
+        utf8,
+        /// Letters consist of any number of characters
+        generic,
+    };
+
+    /// Kind of a letter of a #Word with respect to the alphabet
+    enum class LetterClass {
+        /// Letter in the alphabet
+        letter,
+        /// ASCII white space character
+        space,
+        /// Any other code point
+        foreign,
+    };
+
     // Define an alphabet by providing lowercase and uppercase letters
     // @note The letters in the same index must correspond to the same case.
     // @warning Throws if any letter contains a regex special character.
+    // @warning Throws if any letter is empty or not valid UTF-8.
+    // @warning Throws if there are more letters than #foreign_letter_id.
     Alphabet(const std::vector<std::string>& lowercase_letters, const std::vector<std::string>& uppercase_letters);
 
     /// Similar to std::tolower
@@ -49,11 +81,50 @@ public:
     /// @warning Throws if no such letter exists in the alphabet
     Letter get_letter_from_hash(size_t hash) const&;
 
+    /// Number of letters in the alphabet, disregarding case
+    size_t size() const noexcept;
+
+    /// Identifier of a letter in the order it is defined, disregarding case
+    /// @return #foreign_letter_id if no such letter exists in the alphabet
+    LetterId get_letter_id(Letter letter) const& noexcept;
+
+    /// Lowercase letter with given identifier
+    /// @warning Throws if @a id is not less than #size.
+    Letter get_lowercase_letter(LetterId id) const&;
+
+    /// Whether @a letter is in the alphabet, a space or foreign
+    LetterClass classify(Letter letter) const& noexcept;
+
+    /// Splitting strategy that fits every letter in the alphabet
+    Encoding get_encoding() const noexcept;
+
+    /// Maximum number of characters in a letter
+    size_t get_max_letter_size() const noexcept;
+
+    /// Similar to #get_letter_id for a single character, by a table lookup
+    LetterId get_byte_letter_id(char ch) const noexcept;
+
+    /// Similar to #tolower for a single character, by a table lookup
+    /// @note Only valid when #get_encoding is Encoding::single_byte
+    char tolower_byte(char uppercase) const noexcept;
+
+    /// Similar to #toupper for a single character, by a table lookup
+    /// @note Only valid when #get_encoding is Encoding::single_byte
+    char toupper_byte(char lowercase) const noexcept;
+
 private:
+    using ByteTable = std::array<char, std::numeric_limits<unsigned char>::max() + 1>;
+
+    Encoding encoding;
+    size_t max_letter_size;
+    std::vector<std::string> lowercase_letters_by_id;
+    std::vector<std::string> uppercase_letters_by_id;
+    std::unordered_map<size_t, LetterId> letter_id_map;
+    std::array<LetterId, std::numeric_limits<unsigned char>::max() + 1> byte_letter_ids;
+    ByteTable byte_tolower_table;
+    ByteTable byte_toupper_table;
     std::map<size_t, std::string> lowercase_hash_map;
     std::map<size_t, std::string> uppercase_hash_map;
-    std::map<size_t, size_t> tolower_map;
-    std::map<size_t, size_t> toupper_map;
 };
 
 /**
@@ -0,0 +1,88 @@
+#ifndef SPELLER_ANAGRAM_INDEX_HPP
+#define SPELLER_ANAGRAM_INDEX_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <set>
+#include <string>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Headers
+#include <speller/entry_store.hpp>
+#include <speller/query_budget.hpp>
+#include <speller/result_page.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+/// Entry that consists of the letters of a query
+struct AnagramMatch {
+    /// Identifier of the entry
+    size_t entry_id;
+
+    /// Letters covered by jokers, in entry order
+    /// @note Letters outside the alphabet, e.g. space, are included as they are.
+    std::vector<std::string> joker_letters;
+};
+
+/**
+Lowercase letters of each entry, to find entries that consist of given letters
+
+@code
+speller::AnagramIndex index(store, "tr");
+std::vector<speller::AnagramMatch> matches = index.find("ka?", budget, page);
+@endcode
+*/
+class AnagramIndex {
+public:
+    /**
+    Analyze letters of each entry in @a store
+
+    @param previous Index of @a previous_store in the same locale, whose analysis is reused for entries with the same text
+    */
+    AnagramIndex(const EntryStore& store, const std::string& locale_name,
+        const AnagramIndex* previous = nullptr, const EntryStore* previous_store = nullptr);
+
+    /**
+    Entries with the same number of letters as @a query that contain every letter of it
+
+    Each `?` stands for any letter.
+    */
+    std::vector<AnagramMatch> find(const std::string& query, QueryBudget& budget, ResultPage& page) const;
+
+    /// Similar to #find, examining only @a candidate_ids, which are in ascending order
+    std::vector<AnagramMatch> find(const std::string& query, const std::vector<size_t>& candidate_ids, QueryBudget& budget, ResultPage& page) const;
+
+    /// Lowercase text of the entry
+    const std::string& get_lowercase_str(size_t entry_id) const&;
+
+    const std::string& get_locale_name() const& noexcept;
+
+private:
+    class WordInfo {
+    public:
+        WordInfo(const std::string& str, const std::string& locale_name);
+
+        size_t length() const noexcept;
+
+        const std::string& get_lowercase_str() const& noexcept;
+
+        const std::multiset<size_t>& get_hashes() const& noexcept;
+
+    private:
+        std::string lowercase_str;
+        size_t num_letters;
+        std::multiset<size_t> hashes;
+    };
+
+    // examine the entries get_id(0), get_id(1), ... get_id(num_candidates - 1)
+    template <typename GetId>
+    std::vector<AnagramMatch> find_in(const std::string& query, size_t num_candidates, GetId get_id, QueryBudget& budget, ResultPage& page) const;
+
+    std::string locale_name;
+    std::vector<WordInfo> infos;
+};
+
+} // namespace speller
+
+#endif // SPELLER_ANAGRAM_INDEX_HPP
@@ -0,0 +1,143 @@
+#ifndef SPELLER_BUILTIN_ALPHABETS_HPP
+#define SPELLER_BUILTIN_ALPHABETS_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <array>
+#include <string_view>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Headers
+#include <speller/alphabet.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+/// Lowercase and uppercase forms of a letter, known at compile time
+struct LetterCasePair {
+    std::string_view lowercase;
+    std::string_view uppercase;
+};
+
+/// Maximum number of characters in a letter of @a letters
+template <size_t N>
+constexpr size_t get_max_letter_size(const std::array<LetterCasePair, N>& letters) noexcept;
+
+/**
+Create an #Alphabet from a compile time table
+
+Tables for other alphabet resource files are generated by `speller_alphabet_table`.
+Built-in locales are created from their tables by Locale, so other tables are added under their own names.
+
+@code
+speller::Locale::add_locale("az", speller::alphabet_from_table(az_letters));
+@endcode
+*/
+template <size_t N>
+Alphabet alphabet_from_table(const std::array<LetterCasePair, N>& letters);
+
+/// English alphabet
+inline constexpr std::array<LetterCasePair, 26> en_letters = { {
+    { "a", "A" },
+    { "b", "B" },
+    { "c", "C" },
+    { "d", "D" },
+    { "e", "E" },
+    { "f", "F" },
+    { "g", "G" },
+    { "h", "H" },
+    { "i", "I" },
+    { "j", "J" },
+    { "k", "K" },
+    { "l", "L" },
+    { "m", "M" },
+    { "n", "N" },
+    { "o", "O" },
+    { "p", "P" },
+    { "q", "Q" },
+    { "r", "R" },
+    { "s", "S" },
+    { "t", "T" },
+    { "u", "U" },
+    { "v", "V" },
+    { "w", "W" },
+    { "x", "X" },
+    { "y", "Y" },
+    { "z", "Z" },
+} };
+
+/// Turkish alphabet, generated from res/alfabe.txt by speller_alphabet_table
+inline constexpr std::array<LetterCasePair, 29> tr_letters = { {
+    { "a", "A" },
+    { "b", "B" },
+    { "c", "C" },
+    { "\303\247", "\303\207" }, // ç Ç
+    { "d", "D" },
+    { "e", "E" },
+    { "f", "F" },
+    { "g", "G" },
+    { "\304\237", "\304\236" }, // ğ Ğ
+    { "h", "H" },
+    { "\304\261", "I" }, // ı I
+    { "i", "\304\260" }, // i İ
+    { "j", "J" },
+    { "k", "K" },
+    { "l", "L" },
+    { "m", "M" },
+    { "n", "N" },
+    { "o", "O" },
+    { "\303\266", "\303\226" }, // ö Ö
+    { "p", "P" },
+    { "r", "R" },
+    { "s", "S" },
+    { "\305\237", "\305\236" }, // ş Ş
+    { "t", "T" },
+    { "u", "U" },
+    { "\303\274", "\303\234" }, // ü Ü
+    { "v", "V" },
+    { "y", "Y" },
+    { "z", "Z" },
+} };
+
+} // namespace speller
+
+////////////////////////////////////////////////////////////////////////////////
+// INLINE DEFINITIONS
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <algorithm>
+#include <string>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+template <size_t N>
+constexpr size_t get_max_letter_size(const std::array<LetterCasePair, N>& letters) noexcept
+{
+    size_t max_letter_size = 0;
+    for (const LetterCasePair& pair : letters) {
+        max_letter_size = std::max({ max_letter_size, pair.lowercase.size(), pair.uppercase.size() });
+    }
+    return max_letter_size;
+}
+
+template <size_t N>
+Alphabet alphabet_from_table(const std::array<LetterCasePair, N>& letters)
+{
+    std::vector<std::string> lowercase_letters;
+    std::vector<std::string> uppercase_letters;
+    for (const LetterCasePair& pair : letters) {
+        lowercase_letters.emplace_back(pair.lowercase);
+        uppercase_letters.emplace_back(pair.uppercase);
+    }
+    return Alphabet(lowercase_letters, uppercase_letters);
+}
+
+// English text is split with table lookups only
+static_assert(get_max_letter_size(en_letters) == 1);
+
+} // namespace speller
+
+#endif // SPELLER_BUILTIN_ALPHABETS_HPP
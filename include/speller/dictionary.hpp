@@ -0,0 +1,160 @@
+#ifndef SPELLER_DICTIONARY_HPP
+#define SPELLER_DICTIONARY_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <filesystem>
+#include <memory>
+#include <regex>
+#include <string>
+#include <string_view>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Headers
+#include <speller/anagram_index.hpp>
+#include <speller/entry_statistics.hpp>
+#include <speller/entry_store.hpp>
+#include <speller/letter_matrix.hpp>
+#include <speller/letter_trie.hpp>
+#include <speller/phrase_index.hpp>
+#include <speller/query_budget.hpp>
+#include <speller/query_planner.hpp>
+#include <speller/result_page.hpp>
+#include <speller/sorted_key_index.hpp>
+#include <speller/substring_automaton.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+/**
+Dictionary entries in given locale, with every kind of query answered from a single copy
+
+Each index is built on first use by a query that needs it, and is shared by all later queries.
+Building is thread safe, so that queries can be answered concurrently.
+
+@code
+speller::Dictionary dictionary(speller::EntryStore::from_file("tr.txt"), "tr");
+std::vector<speller::EntryHandle> matches = dictionary.match_wildcard("ka*", budget, page);
+std::vector<speller::AnagramMatch> anagrams = dictionary.find_anagrams("kale", budget, page);
+@endcode
+*/
+class Dictionary {
+public:
+    /**
+    Take ownership of @a entries, without building any index
+
+    @param previous Dictionary of the previous version of @a entries in any locale,
+    whose built indexes are rebuilt immediately, reusing their analysis where possible
+    @warning Throws if locale does not exist.
+    */
+    Dictionary(EntryStore entries, std::string locale_name, const Dictionary* previous = nullptr);
+
+    /// @warning Throws if file does not exist, is not valid UTF-8 or locale does not exist.
+    static Dictionary from_file(const std::filesystem::path& filename, std::string locale_name);
+
+    Dictionary(Dictionary&&) noexcept;
+    Dictionary& operator=(Dictionary&&) noexcept;
+
+    ~Dictionary();
+
+    /// Number of entries
+    size_t size() const noexcept;
+
+    /// Text of the entry at given index
+    std::string_view operator[](size_t id) const& noexcept;
+
+    const EntryStore& get_entries() const& noexcept;
+
+    const std::string& get_locale_name() const& noexcept;
+
+    /// Entries that contain a match of @a rgx
+    /// @see speller::search_regex
+    std::vector<EntryHandle> search_regex(const std::regex& rgx, QueryBudget& budget, ResultPage& page) const;
+
+    /**
+    Entries whose lowercase form matches a wildcard pattern as a whole
+
+    A pattern without wildcards is looked up directly.
+    Otherwise, the candidates of #plan_wildcard are tested,
+    where a full scan or a key prefix alone tests each distinct key of #get_key_index once.
+    Matches are accounted in dictionary order, and testing stops once @a page is complete,
+    except for distinct keys, which are all tested before any match is accounted, since they are not in dictionary order.
+
+    @see wildcard_to_regex
+    @warning Throws if @a pattern is not a valid regex after conversion.
+    */
+    std::vector<EntryHandle> match_wildcard(const std::string& pattern, QueryBudget& budget, ResultPage& page) const;
+
+    /// Similar to AnagramIndex::find, testing only the candidates of #plan_anagrams
+    std::vector<AnagramMatch> find_anagrams(const std::string& query, QueryBudget& budget, ResultPage& page) const;
+
+    /// Similar to LetterMatrix::find, testing only the candidates of #plan_letter_set
+    std::vector<size_t> find_letter_set(const LetterSetQuery& query, QueryBudget& budget, ResultPage& page) const;
+
+    /// @see LetterTrie::find_formable
+    std::vector<RackMatch> find_formable(const RackQuery& query, const std::vector<size_t>& letter_scores, QueryBudget& budget, ResultPage& page) const;
+
+    /// @see PhraseIndex::find
+    std::vector<size_t> find_phrases(const PhraseQuery& query, QueryBudget& budget, ResultPage& page) const;
+
+    /// Entries that contain each of @a patterns, in a single pass over the entries
+    /// @see SubstringAutomaton::find_all
+    std::vector<std::vector<size_t>> find_substrings(const std::vector<std::string>& patterns, QueryBudget& budget) const;
+
+    /// Line of a match of #find_anagrams, i.e. the lowercase entry followed by a tab and the letters covered by jokers, if @a has_jokers
+    std::string format_anagram_match(const AnagramMatch& match, bool has_jokers) const;
+
+    /// Line of a match of #find_formable, i.e. the entry followed by a tab and the score, if @a has_scores, and by a tab and the letters covered by jokers, if @a has_jokers
+    std::string format_rack_match(const RackMatch& match, bool has_scores, bool has_jokers) const;
+
+    /**
+    Plan of #match_wildcard
+
+    The key index is always used, and the suffix index if the pattern ends with literal letters.
+    Statistics are used only if #get_statistics was called before.
+    */
+    QueryPlan plan_wildcard(const std::string& pattern) const;
+
+    /// Plan of #find_anagrams, using any of the statistics and the key indexes that are built
+    QueryPlan plan_anagrams(const std::string& query) const;
+
+    /// Plan of #find_letter_set, using the letter matrix and any of the statistics and the key indexes that are built
+    QueryPlan plan_letter_set(const LetterSetQuery& query) const;
+
+    /// Statistics for planning queries, which also find entries by length and letters
+    const EntryStatistics& get_statistics() const&;
+
+    const SortedKeyIndex& get_key_index() const&;
+
+    /// Index of keys with their letters reversed, which is only used if #uses_suffix_index
+    const SortedKeyIndex& get_suffix_index() const&;
+
+    /// Whether letters are reversed independently of their neighbors, so that queries can use #get_suffix_index
+    /// @note Alphabets with multi-character letters do not use it.
+    bool uses_suffix_index() const;
+
+    const AnagramIndex& get_anagram_index() const&;
+
+    const LetterMatrix& get_letter_matrix() const&;
+
+    const LetterTrie& get_letter_trie() const&;
+
+    const PhraseIndex& get_phrase_index() const&;
+
+private:
+    struct Indexes;
+
+    // indexes that are built, and whose letters can be reversed
+    PlanningIndexes get_built_indexes() const;
+
+    // intersection of the entries of the access paths of a plan that does not scan every entry, in ascending order
+    std::vector<size_t> find_candidates(const QueryPlan& plan) const;
+
+    EntryStore entries;
+    std::string locale_name;
+    std::unique_ptr<Indexes> indexes;
+};
+
+} // namespace speller
+
+#endif // SPELLER_DICTIONARY_HPP
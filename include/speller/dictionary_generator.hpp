@@ -0,0 +1,80 @@
+#ifndef SPELLER_DICTIONARY_GENERATOR_HPP
+#define SPELLER_DICTIONARY_GENERATOR_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+/// Distributions that synthetic dictionary entries are drawn from
+struct DictionaryProfile {
+    /// Relative frequency of each lowercase letter, indexed by #LetterId
+    std::vector<size_t> letter_weights;
+
+    /// Relative frequency of each word length, indexed by number of letters
+    std::vector<size_t> length_weights;
+
+    /// Relative frequency of each entry size, indexed by number of space separated words
+    std::vector<size_t> word_count_weights;
+
+    /// Number of entries in a thousand that start with an uppercase letter
+    size_t capitalized_per_mille = 0;
+};
+
+/// Equally frequent letters, word lengths similar to a natural language and one in five entries having multiple words
+DictionaryProfile default_dictionary_profile(const std::string& locale_name);
+
+/**
+Measure distributions of existing entries in given locale
+
+Characters that do not exist in the alphabet are ignored.
+
+@warning Throws if no entry contains a letter.
+*/
+DictionaryProfile dictionary_profile_from_entries(const std::vector<std::string_view>& entries, const std::string& locale_name);
+
+/**
+Reproducible generator of synthetic dictionary entries
+
+The same profile, alphabet and seed always generate the same entries on any platform,
+since random numbers are drawn by a fixed algorithm (SplitMix64) instead of standard distributions.
+
+@code
+speller::DictionaryGenerator generator(speller::default_dictionary_profile("tr"), "tr", 42);
+std::string entry = generator.next();
+@endcode
+*/
+class DictionaryGenerator {
+public:
+    /// @warning Throws if the profile has no letter, length or word count with nonzero weight.
+    DictionaryGenerator(const DictionaryProfile& profile, const std::string& locale_name, std::uint64_t seed);
+
+    /// Append the next entry to @a str, without a line feed
+    void append_next(std::string& str);
+
+    /// Generate the next entry
+    std::string next();
+
+private:
+    std::uint64_t next_random() noexcept;
+
+    // index drawn with probability proportional to its weight
+    size_t pick(const std::vector<std::uint64_t>& cumulative_weights) noexcept;
+
+    std::vector<std::string> lowercase_letters;
+    std::vector<std::string> uppercase_letters;
+    std::vector<std::uint64_t> cumulative_letter_weights;
+    std::vector<std::uint64_t> cumulative_length_weights;
+    std::vector<std::uint64_t> cumulative_word_count_weights;
+    size_t capitalized_per_mille;
+    std::uint64_t state;
+};
+
+} // namespace speller
+
+#endif // SPELLER_DICTIONARY_GENERATOR_HPP
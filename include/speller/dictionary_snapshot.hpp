@@ -0,0 +1,72 @@
+#ifndef SPELLER_DICTIONARY_SNAPSHOT_HPP
+#define SPELLER_DICTIONARY_SNAPSHOT_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Headers
+#include <speller/dictionary.hpp>
+#include <speller/live_snapshot.hpp>
+#include <speller/locale.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+/// Resource files of a dictionary, as given on the command line of an executable
+struct DictionaryFiles {
+    std::filesystem::path speller_path;
+
+    /// Alphabet resource file, empty for #locale_name to be an existing locale
+    std::filesystem::path alphabet_path;
+
+    /// Name of the locale of the alphabet resource file
+    std::string locale_name = Locale::default_locale_name;
+
+    /// Letter score resource file, empty if letters are not scored
+    std::filesystem::path scores_path;
+
+    /// Files that are given, to be watched for changes
+    std::vector<std::filesystem::path> get_paths() const;
+};
+
+/// Resources that are replaced as a whole when their files change
+struct DictionarySnapshot {
+    /// Content of the alphabet resource file, so that an unchanged alphabet keeps its locale
+    std::string alphabet_content;
+
+    /// Name of the locale that was added for the alphabet resource file, which is removed once no snapshot uses it
+    /// @note Declared before #dictionary, so that it is removed after the dictionary is destroyed.
+    std::shared_ptr<const std::string> added_locale_name;
+
+    /// Score of each letter, empty if letters are not scored
+    std::vector<size_t> letter_scores;
+
+    Dictionary dictionary;
+};
+
+/// Build the indexes that the queries of an executable need, before the snapshot is published
+using IndexBuilder = std::function<void(const Dictionary&)>;
+
+/**
+Loader of the snapshots of the dictionary of @a files
+
+A changed alphabet is added as a new locale, while an unchanged one keeps the locale of the previous snapshot.
+The locale is removed once the last snapshot that uses it is freed.
+The indexes that the previous snapshot built are rebuilt, and then @a build_indexes is called.
+
+@code
+speller::LiveSnapshot<speller::DictionarySnapshot> live(
+    speller::dictionary_snapshot_loader(files, [](const speller::Dictionary& dictionary) { dictionary.get_anagram_index(); }),
+    files.get_paths());
+@endcode
+*/
+LiveSnapshot<DictionarySnapshot>::Loader dictionary_snapshot_loader(DictionaryFiles files, IndexBuilder build_indexes = {});
+
+} // namespace speller
+
+#endif // SPELLER_DICTIONARY_SNAPSHOT_HPP
@@ -0,0 +1,77 @@
+#ifndef SPELLER_ENTRY_STATISTICS_HPP
+#define SPELLER_ENTRY_STATISTICS_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <cstdint>
+#include <string>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Headers
+#include <speller/alphabet.hpp>
+#include <speller/entry_store.hpp>
+#include <speller/letter_matrix.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+/**
+Number of letters and set of letters of every entry, grouped by the number of letters
+
+Counts estimate how many entries a query can match, and the groups are scanned to find the entries
+within a length range that contain given letters.
+Letters are compared by Alphabet::get_letter_id, so that case is disregarded.
+
+@code
+speller::EntryStatistics statistics(store, "tr");
+size_t num_four_letter_entries = statistics.count_length(4, 4);
+std::vector<size_t> ids = statistics.find(4, 4, required_letters_mask);
+@endcode
+*/
+class EntryStatistics {
+public:
+    /// @warning Throws if locale does not exist or @a store has more entries than std::uint32_t can identify.
+    EntryStatistics(const EntryStore& store, const std::string& locale_name);
+
+    /// Number of entries
+    size_t size() const noexcept;
+
+    /// Number of entries with [@a min_length, @a max_length] letters
+    size_t count_length(size_t min_length, size_t max_length) const noexcept;
+
+    /// Number of entries with @a length letters, all of which are in the alphabet
+    size_t count_alphabet_only(size_t length) const noexcept;
+
+    /// Fraction of entries that contain the letter at least once
+    double get_entry_frequency(LetterId id) const noexcept;
+
+    /// Fraction of all letters of all entries that are the letter
+    double get_letter_frequency(LetterId id) const noexcept;
+
+    /**
+    Identifiers of the entries with [@a min_length, @a max_length] letters that contain every letter of @a required, in ascending order
+
+    @note Letters whose identifiers do not fit in a #LetterMask are not tracked, and are ignored in @a required.
+    */
+    std::vector<size_t> find(size_t min_length, size_t max_length, LetterMask required) const;
+
+    /// Number of bytes held, excluding the object itself
+    size_t get_memory_size() const noexcept;
+
+private:
+    // ids_by_length[length_offsets[n], length_offsets[n + 1]) have n letters, in ascending order
+    std::vector<std::uint32_t> length_offsets;
+    std::vector<std::uint32_t> ids_by_length;
+    // letters of the entries in the same order as ids_by_length
+    std::vector<LetterMask> masks_by_length;
+    // indexed by length
+    std::vector<size_t> alphabet_only_counts;
+    // indexed by LetterId
+    std::vector<size_t> entry_counts;
+    std::vector<size_t> letter_counts;
+    size_t total_letter_count = 0;
+};
+
+} // namespace speller
+
+#endif // SPELLER_ENTRY_STATISTICS_HPP
@@ -0,0 +1,61 @@
+#ifndef SPELLER_ENTRY_STORE_HPP
+#define SPELLER_ENTRY_STORE_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+/// Reference to an entry of an #EntryStore
+/// @warning Valid only as long as the store is alive and unmodified.
+struct EntryHandle {
+    /// Line index of the entry
+    size_t id;
+
+    /// Text of the entry, pointing into the store
+    std::string_view text;
+};
+
+/// Dictionary content kept in a single buffer, with a span for each line
+class EntryStore {
+public:
+    /// Split @a content into lines
+    /// @warning Throws if @a content is not valid UTF-8.
+    explicit EntryStore(std::string content);
+
+    /// @warning Throws if file does not exist or is not valid UTF-8.
+    static EntryStore from_file(const std::filesystem::path& filename);
+
+    /// Number of entries
+    size_t size() const noexcept;
+
+    /// Text of the entry at given index
+    std::string_view operator[](size_t id) const& noexcept;
+
+    /// Handle of the entry at given index
+    EntryHandle get_handle(size_t id) const& noexcept;
+
+    /// Text of all entries in order
+    std::vector<std::string_view> get_entries() const&;
+
+    /// Whole content
+    const std::string& get_content() const& noexcept;
+
+private:
+    struct Span {
+        size_t offset;
+        size_t length;
+    };
+
+    std::string content;
+    std::vector<Span> spans;
+};
+
+} // namespace speller
+
+#endif // SPELLER_ENTRY_STORE_HPP
@@ -0,0 +1,43 @@
+#ifndef SPELLER_FILE_WATCHER_HPP
+#define SPELLER_FILE_WATCHER_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <chrono>
+#include <filesystem>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+/**
+Detect modifications of a set of files
+
+Uses inotify on Linux, watching the parent directories so that files replaced by rename are detected as well.
+Falls back to polling the last write times elsewhere.
+*/
+class FileWatcher {
+public:
+    /// @warning Throws if a file does not exist.
+    explicit FileWatcher(std::vector<std::filesystem::path> paths);
+
+    FileWatcher(const FileWatcher&) = delete;
+    FileWatcher& operator=(const FileWatcher&) = delete;
+
+    ~FileWatcher();
+
+    /// Block until a watched file is modified or @a timeout elapses
+    /// @return true if a watched file is modified
+    bool wait_for_change(std::chrono::milliseconds timeout);
+
+private:
+    bool poll_write_times();
+
+    std::vector<std::filesystem::path> paths;
+    std::vector<std::filesystem::file_time_type> write_times;
+    int inotify_fd = -1;
+};
+
+} // namespace speller
+
+#endif // SPELLER_FILE_WATCHER_HPP
@@ -0,0 +1,172 @@
+#ifndef SPELLER_FRONT_CODED_STRINGS_HPP
+#define SPELLER_FRONT_CODED_STRINGS_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+/**
+Sorted distinct strings, each stored without the prefix it shares with the previous string
+
+Strings are grouped into blocks of #block_size.
+The first string of each block is stored in full, so that blocks are binary searched by their first strings
+without decoding, and any block is decoded on its own.
+
+@code
+speller::FrontCodedStrings strings({ "tasdik", "tasdikli", "tasdikname", "tasdiksiz" });
+auto [begin, end] = strings.find_prefix("tasdikn");
+strings.for_each(begin, end, [](size_t index, std::string_view str) { ... return true; });
+@endcode
+*/
+class FrontCodedStrings {
+public:
+    /// Number of strings in a block
+    static constexpr size_t block_size = 16;
+
+    /// Returned by #find when the string does not exist
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    /// No strings
+    FrontCodedStrings();
+
+    /// @warning Throws if @a sorted_strings are not sorted in ascending order or not distinct.
+    explicit FrontCodedStrings(const std::vector<std::string_view>& sorted_strings);
+
+    /// Read strings written by #save
+    /// @warning Throws if the stream does not contain strings written by #save.
+    static FrontCodedStrings load(std::istream& is);
+
+    /// Write strings in a binary format
+    /// @warning Throws if writing fails.
+    void save(std::ostream& os) const;
+
+    /// Number of strings
+    size_t size() const noexcept;
+
+    /// Decode string at given index
+    /// @warning Throws if @a index is not less than #size.
+    std::string at(size_t index) const;
+
+    /// Index of the first string that is not less than @a key
+    size_t lower_bound(std::string_view key) const;
+
+    /// Index of @a key, or #npos if it does not exist
+    size_t find(std::string_view key) const;
+
+    /// Range of the indices of the strings that start with @a prefix
+    std::pair<size_t, size_t> find_prefix(std::string_view prefix) const;
+
+    /**
+    Decode strings in [@a begin, @a end) in order
+
+    Each block is decoded sequentially, copying only the suffix of each string.
+
+    @param visitor Called as `bool visitor(size_t index, std::string_view str)`, returning false to stop
+    */
+    template <typename Visitor>
+    void for_each(size_t begin, size_t end, Visitor visitor) const;
+
+    /// Number of bytes held, excluding the object itself
+    size_t get_memory_size() const noexcept;
+
+private:
+    // decoding position within a block
+    struct Cursor {
+        const char* position;
+        std::string str;
+    };
+
+    // move to the first string of the block
+    void seek_block(Cursor& cursor, size_t block_index) const;
+
+    // advance to the next string of the same block
+    static void decode_next(Cursor& cursor);
+
+    // first string of the block, pointing into data
+    std::string_view get_block_head(size_t block_index) const noexcept;
+
+    // index of the first string for which predicate is false, given that it is true for all strings before
+    template <typename Predicate>
+    size_t partition_point(Predicate predicate) const;
+
+    // read a size encoded 7 bits per byte, least significant first
+    static size_t read_size(const char*& position) noexcept;
+
+    size_t num_strings;
+    std::string data;
+    std::vector<size_t> block_offsets;
+};
+
+} // namespace speller
+
+////////////////////////////////////////////////////////////////////////////////
+// INLINE DEFINITIONS
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <algorithm>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+inline size_t FrontCodedStrings::read_size(const char*& position) noexcept
+{
+    size_t value = 0;
+    for (int shift = 0;; shift += 7) {
+        const auto byte = static_cast<unsigned char>(*position++);
+        value |= static_cast<size_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            return value;
+        }
+    }
+}
+
+inline void FrontCodedStrings::seek_block(Cursor& cursor, size_t block_index) const
+{
+    cursor.position = data.data() + block_offsets[block_index];
+    const size_t size = read_size(cursor.position);
+    cursor.str.assign(cursor.position, size);
+    cursor.position += size;
+}
+
+inline void FrontCodedStrings::decode_next(Cursor& cursor)
+{
+    const size_t shared_size = read_size(cursor.position);
+    const size_t suffix_size = read_size(cursor.position);
+    cursor.str.resize(shared_size);
+    cursor.str.append(cursor.position, suffix_size);
+    cursor.position += suffix_size;
+}
+
+template <typename Visitor>
+void FrontCodedStrings::for_each(size_t begin, size_t end, Visitor visitor) const
+{
+    end = std::min(end, num_strings);
+    if (begin >= end) {
+        return;
+    }
+    Cursor cursor { nullptr, std::string() };
+    for (size_t index = begin - begin % block_size; index < end; index++) {
+        if (index % block_size == 0) {
+            seek_block(cursor, index / block_size);
+        } else {
+            decode_next(cursor);
+        }
+        if (index >= begin && !visitor(index, std::string_view(cursor.str))) {
+            return;
+        }
+    }
+}
+
+} // namespace speller
+
+#endif // SPELLER_FRONT_CODED_STRINGS_HPP
@@ -30,13 +30,36 @@ private:
     std::string_view sw;
 };
 
+/// Number of characters in a UTF-8 encoded code point, obtained from its first character
+/// @return Zero if @a lead cannot start a code point
+constexpr size_t get_utf8_sequence_size(char lead) noexcept
+{
+    const auto byte = static_cast<unsigned char>(lead);
+    if (byte < 0x80) {
+        return 1;
+    }
+    if (byte < 0xC0) {
+        return 0;
+    }
+    if (byte < 0xE0) {
+        return 2;
+    }
+    if (byte < 0xF0) {
+        return 3;
+    }
+    if (byte < 0xF8) {
+        return 4;
+    }
+    return 0;
+}
+
 } // namespace speller
 
 ////////////////////////////////////////////////////////////////////////////////
 
 template <>
 struct std::less<speller::Letter> {
-    constexpr bool operator()(const speller::Letter& lhs, const speller::Letter& rhs) const noexcept
+    bool operator()(const speller::Letter& lhs, const speller::Letter& rhs) const noexcept
     {
         return lhs.string_view() < rhs.string_view();
     }
@@ -0,0 +1,90 @@
+#ifndef SPELLER_LETTER_MATRIX_HPP
+#define SPELLER_LETTER_MATRIX_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Headers
+#include <speller/alphabet.hpp>
+#include <speller/query_budget.hpp>
+#include <speller/result_page.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+/// Set of letters where bit `i` stands for the letter with #LetterId `i`
+using LetterMask = std::uint64_t;
+
+/// Letter set for each position of a word, similar to "^[abc][de]...$"
+struct LetterSetQuery {
+    /// Allowed letters at each position
+    std::vector<LetterMask> position_masks;
+
+    /// Minimum number of occurrences of each letter, indexed by #LetterId
+    std::vector<size_t> required_letter_counts;
+};
+
+/**
+Parse a #LetterSetQuery in given locale
+
+Each position is described by one of the following.
+
+- A letter, e.g. `a`
+- A letter set, e.g. `[abc]`
+- Any letter, i.e. `?`
+
+Letters that the word must contain can be appended after a slash (`/`).
+
+@code
+[piyano][telefon][anahtar][sandalye]??/ea
+@endcode
+
+@warning Throws if the query is malformed or refers to a letter that does not exist in the alphabet.
+*/
+LetterSetQuery parse_letter_set_query(const std::string& query, const std::string& locale_name);
+
+/// Whether @a word satisfies @a query, as it would if it were stored in a #LetterMatrix
+/// @warning Throws if locale does not exist or @a word is not valid UTF-8.
+bool matches_letter_set(const LetterSetQuery& query, std::string_view word, const std::string& locale_name);
+
+/**
+Words grouped by their length, with letter identifiers stored column by column
+
+Each position filter of a #LetterSetQuery is a table test over one contiguous column.
+
+@note Words containing characters that do not exist in the alphabet (e.g. space) are not stored.
+*/
+class LetterMatrix {
+public:
+    /// @warning Throws if the alphabet has more letters than a #LetterMask can hold.
+    LetterMatrix(const std::vector<std::string_view>& words, const std::string& locale_name);
+
+    /// Indices of the words that satisfy @a query, in ascending order
+    std::vector<size_t> find(const LetterSetQuery& query) const;
+
+    /// Similar to #find, stopping early when @a budget is exhausted or @a page is complete
+    /// @return Indices of the words in @a page
+    /// @note Each stored word is accounted as a candidate per position it is tested against.
+    std::vector<size_t> find(const LetterSetQuery& query, QueryBudget& budget, ResultPage& page) const;
+
+    /// Number of stored words with given number of letters
+    size_t count_words(size_t length) const noexcept;
+
+private:
+    struct Bucket {
+        std::vector<size_t> word_indices;
+        // letter_ids[position * word_indices.size() + row]
+        std::vector<LetterId> letter_ids;
+    };
+
+    size_t alphabet_size;
+    std::vector<Bucket> buckets;
+};
+
+} // namespace speller
+
+#endif // SPELLER_LETTER_MATRIX_HPP
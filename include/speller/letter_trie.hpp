@@ -0,0 +1,119 @@
+#ifndef SPELLER_LETTER_TRIE_HPP
+#define SPELLER_LETTER_TRIE_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Headers
+#include <speller/alphabet.hpp>
+#include <speller/query_budget.hpp>
+#include <speller/result_page.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+/// Letters available to form words, similar to a word game rack
+struct RackQuery {
+    /// Number of available letters, indexed by #LetterId
+    std::vector<size_t> letter_counts;
+
+    /// Number of wildcards that stand for any letter
+    size_t num_jokers = 0;
+};
+
+/**
+Parse a #RackQuery in given locale
+
+Each letter is available once per occurrence, and `?` stands for any letter.
+
+@code
+aaksuv??
+@endcode
+
+@warning Throws if the query refers to a letter that does not exist in the alphabet.
+*/
+RackQuery parse_rack_query(const std::string& query, const std::string& locale_name);
+
+/**
+Read score of each letter from resource file
+
+Each line contains a letter and its score, separated by tab (`\t`) character.
+Letters that are not listed score zero.
+
+@code
+a	1
+b	3
+...
+@endcode
+
+@warning Throws if file does not exist, formatting is incorrect or a letter does not exist in the alphabet.
+*/
+std::vector<size_t> letter_scores_from_file(const std::string& filename, const std::string& locale_name);
+
+/// Word that can be formed from a #RackQuery
+struct RackMatch {
+    /// Index of the word
+    size_t word_index;
+
+    /// Number of letters in the word
+    size_t length;
+
+    /// Total score of the letters that are not covered by jokers
+    size_t score;
+
+    /// Letters covered by jokers, in word order
+    std::vector<LetterId> joker_letter_ids;
+};
+
+/**
+Prefix tree of words over letter identifiers
+
+@note Words containing characters that do not exist in the alphabet (e.g. space) are not stored.
+*/
+class LetterTrie {
+public:
+    LetterTrie(const std::vector<std::string_view>& words, const std::string& locale_name);
+
+    /**
+    Words of any length that can be formed from @a query, each letter being used at most once
+
+    The trie is walked once while keeping the remaining count of each letter.
+    Results are ordered by descending score, then by descending length, then by index.
+
+    @param letter_scores Score of each letter, indexed by #LetterId. Letters not covered score zero.
+    */
+    std::vector<RackMatch> find_formable(const RackQuery& query, const std::vector<size_t>& letter_scores = {}) const;
+
+    /// Similar to #find_formable, stopping early when @a budget is exhausted
+    /// @return Matches in @a page, after ranking all matches
+    /// @note Each visited trie node is accounted as a candidate, and results are accounted after ranking,
+    /// so that the maximum number of results keeps the top ranked ones, unlike the other limits.
+    std::vector<RackMatch> find_formable(const RackQuery& query, const std::vector<size_t>& letter_scores, QueryBudget& budget, ResultPage& page) const;
+
+private:
+    struct Node {
+        // edges[edges_begin, edges_end) leave this node
+        std::uint32_t edges_begin;
+        std::uint32_t edges_end;
+        // word_indices[words_begin, words_end) end at this node
+        std::uint32_t words_begin;
+        std::uint32_t words_end;
+    };
+
+    struct Edge {
+        LetterId letter_id;
+        std::uint32_t target;
+    };
+
+    std::vector<Node> nodes;
+    std::vector<Edge> edges;
+    std::vector<size_t> word_indices;
+};
+
+} // namespace speller
+
+#endif // SPELLER_LETTER_TRIE_HPP
@@ -0,0 +1,165 @@
+#ifndef SPELLER_LIVE_SNAPSHOT_HPP
+#define SPELLER_LIVE_SNAPSHOT_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <atomic>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Headers
+#include <speller/file_watcher.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+/**
+Immutable state that is rebuilt in the background whenever its source files change
+
+Readers obtain the current snapshot with #get and keep using it until they are done,
+while a new snapshot is built and published atomically, similar to read-copy-update.
+The previous snapshot is freed once its last reader releases it.
+
+@code
+LiveSnapshot<State> live(load_state, { dictionary_path, alphabet_path });
+while (true) {
+    const std::shared_ptr<const State> state = live.get();
+    // answer a query using *state
+}
+@endcode
+*/
+template <typename T>
+class LiveSnapshot {
+public:
+    /// Build a snapshot, given the previous one if any, so that unchanged parts can be reused
+    using Loader = std::function<std::shared_ptr<const T>(const T* previous)>;
+
+    /// Load the initial snapshot, then reload whenever a file in @a watched_paths changes
+    /// @note Nothing is watched if @a watched_paths is empty.
+    /// @warning Throws if the initial load fails or a watched file does not exist.
+    LiveSnapshot(Loader loader, std::vector<std::filesystem::path> watched_paths = {});
+
+    LiveSnapshot(const LiveSnapshot&) = delete;
+    LiveSnapshot& operator=(const LiveSnapshot&) = delete;
+
+    ~LiveSnapshot();
+
+    /// Current snapshot, which remains valid while the pointer is held
+    std::shared_ptr<const T> get() const;
+
+    /// Number of snapshots published after the initial one
+    size_t get_version() const noexcept;
+
+    /// Number of reloads that failed, so that each failure can be reported once
+    /// @note The previous snapshot is kept when a reload fails.
+    size_t get_num_failures() const noexcept;
+
+    /// Message of the last failed reload, empty if no reload failed
+    std::string get_last_error() const;
+
+private:
+    void watch();
+
+    Loader loader;
+    std::shared_ptr<const T> snapshot;
+    std::atomic<size_t> version = 0;
+    std::atomic<size_t> num_failures = 0;
+    std::atomic<bool> stopping = false;
+    mutable std::mutex error_mutex;
+    std::string last_error;
+    std::unique_ptr<FileWatcher> watcher;
+    std::thread watcher_thread;
+};
+
+} // namespace speller
+
+////////////////////////////////////////////////////////////////////////////////
+// INLINE DEFINITIONS
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <chrono>
+#include <exception>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+template <typename T>
+LiveSnapshot<T>::LiveSnapshot(Loader loader_value, std::vector<std::filesystem::path> watched_paths)
+    : loader(std::move(loader_value))
+    , snapshot(loader(nullptr))
+{
+    if (!watched_paths.empty()) {
+        watcher = std::make_unique<FileWatcher>(std::move(watched_paths));
+        watcher_thread = std::thread(&LiveSnapshot::watch, this);
+    }
+}
+
+template <typename T>
+LiveSnapshot<T>::~LiveSnapshot()
+{
+    stopping = true;
+    if (watcher_thread.joinable()) {
+        watcher_thread.join();
+    }
+}
+
+template <typename T>
+std::shared_ptr<const T> LiveSnapshot<T>::get() const
+{
+    return std::atomic_load(&snapshot);
+}
+
+template <typename T>
+size_t LiveSnapshot<T>::get_version() const noexcept
+{
+    return version;
+}
+
+template <typename T>
+size_t LiveSnapshot<T>::get_num_failures() const noexcept
+{
+    return num_failures;
+}
+
+template <typename T>
+std::string LiveSnapshot<T>::get_last_error() const
+{
+    const std::lock_guard<std::mutex> lock(error_mutex);
+    return last_error;
+}
+
+template <typename T>
+void LiveSnapshot<T>::watch()
+{
+    // wake up regularly to notice destruction
+    constexpr std::chrono::milliseconds wake_up_interval(200);
+    while (!stopping) {
+        if (!watcher->wait_for_change(wake_up_interval)) {
+            continue;
+        }
+        try {
+            // only this thread replaces the snapshot, so the previous one stays alive meanwhile
+            std::shared_ptr<const T> next = loader(snapshot.get());
+            std::atomic_store(&snapshot, std::move(next));
+            version++;
+        } catch (const std::exception& e) {
+            // message is set before the failure is counted, so that it can be read once counted
+            {
+                const std::lock_guard<std::mutex> lock(error_mutex);
+                last_error = e.what();
+            }
+            num_failures++;
+        }
+    }
+}
+
+} // namespace speller
+
+#endif // SPELLER_LIVE_SNAPSHOT_HPP
@@ -4,6 +4,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 // Standard Headers
 #include <map>
+#include <shared_mutex>
 #include <string>
 ////////////////////////////////////////////////////////////////////////////////
 // User Defined Headers
@@ -13,7 +14,9 @@
 namespace speller {
 
 /// Access alphabet of a locale globally via configured name
-/// @note English alphabet is configured to #default_locale_name by default.
+/// @note English alphabet is configured to #default_locale_name and Turkish alphabet to `tr` by default,
+/// each built from its table in builtin_alphabets.hpp on first use.
+/// @note Locales can be added and accessed from multiple threads, and existing ones are looked up under a shared lock.
 class Locale {
 public:
     /// English alphabet locale name
@@ -23,16 +26,33 @@ public:
     explicit Locale(std::string locale_name = default_locale_name);
 
     /// Add locale globally
-    /// @warning Throws if locale exists.
+    /// @warning Throws if locale exists, including a built-in locale that is not used yet.
     static void add_locale(std::string locale_name, Alphabet alphabet);
 
-    /// Access alphabet of given locale
+    /// Add locale globally under @a locale_name, or under a numbered variant of it if it exists
+    /// @return Name of the added locale
+    static std::string add_unique_locale(const std::string& locale_name, Alphabet alphabet);
+
+    /// Remove a locale that was added, so that its name can be reused
+    /// @warning No Locale object of it may be in use, since they keep referring to its alphabet.
+    /// @warning Throws if locale was not added.
+    static void remove_locale(const std::string& locale_name);
+
+    /// Whether given locale exists
+    static bool has_locale(const std::string& locale_name);
+
+    /// Access alphabet of given locale, which is looked up once on construction
     const Alphabet& get_alphabet() const& noexcept;
 
 private:
+    // locale of given name, adding it first if it is built in, or end of #locales if it does not exist
+    // @note #locales_mutex must be held exclusively.
+    static std::map<std::string, Alphabet>::const_iterator find_locale(const std::string& locale_name);
+
     static std::map<std::string, Alphabet> locales;
+    static std::shared_mutex locales_mutex;
 
-    std::string locale_name;
+    const Alphabet* alphabet;
 };
 
 } // namespace speller
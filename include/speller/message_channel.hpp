@@ -0,0 +1,53 @@
+#ifndef SPELLER_MESSAGE_CHANNEL_HPP
+#define SPELLER_MESSAGE_CHANNEL_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <chrono>
+#include <string>
+#include <string_view>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+/**
+Length prefixed messages over a connected stream socket, e.g. one end of a `socketpair(2)`
+
+The socket is closed on destruction.
+
+@note Only available on POSIX systems.
+@warning Ignore `SIGPIPE` beforehand, so that sending to a terminated peer fails instead of terminating the process.
+*/
+class MessageChannel {
+public:
+    /// Take ownership of a socket
+    explicit MessageChannel(int fd) noexcept;
+
+    MessageChannel(const MessageChannel&) = delete;
+    MessageChannel& operator=(const MessageChannel&) = delete;
+
+    MessageChannel(MessageChannel&& other) noexcept;
+    MessageChannel& operator=(MessageChannel&& other) noexcept;
+
+    ~MessageChannel();
+
+    /// @return false if the peer is gone
+    bool send(std::string_view message);
+
+    /// Wait for the next message
+    /// @param timeout Maximum duration to wait, zero for no limit
+    /// @return false if the peer is gone or the timeout expired
+    bool receive(std::string& message, std::chrono::milliseconds timeout = std::chrono::milliseconds(0));
+
+    /// Underlying socket
+    int get_fd() const noexcept;
+
+private:
+    void close() noexcept;
+
+    int fd;
+};
+
+} // namespace speller
+
+#endif // SPELLER_MESSAGE_CHANNEL_HPP
@@ -0,0 +1,118 @@
+#ifndef SPELLER_PHRASE_INDEX_HPP
+#define SPELLER_PHRASE_INDEX_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <cstddef>
+#include <string>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Headers
+#include <speller/entry_store.hpp>
+#include <speller/query_budget.hpp>
+#include <speller/result_page.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+/// Condition on a single word of an entry
+struct PhraseWordFilter {
+    /// Word at any position of the entry
+    static constexpr std::ptrdiff_t any_position = 0;
+
+    /// One-based position of the word, negative to count from the last word, or #any_position
+    std::ptrdiff_t position = any_position;
+
+    /// Wildcard pattern that the lowercase word must match as a whole
+    /// @see wildcard_to_regex
+    std::string pattern;
+};
+
+/// Conditions on the words of an entry, all of which must hold
+struct PhraseQuery {
+    std::vector<PhraseWordFilter> word_filters;
+
+    /// Minimum number of words in the entry
+    size_t min_num_words = 1;
+
+    /// Maximum number of words in the entry
+    size_t max_num_words = QueryLimits::unlimited;
+};
+
+/**
+Parse a #PhraseQuery
+
+The query consists of comma (`,`) separated terms, each of which is one of the following.
+
+- A word pattern, e.g. `etmek`, for entries that contain a matching word
+- A word pattern at a position, e.g. `2:et*`, where `-1:` stands for the last word
+- A number of words, e.g. `#2`, or a minimum number of words, e.g. `#2+`
+
+@code
+#1
+kalem
+-1:etmek,#2
+1:ab?,2:g*
+@endcode
+
+`#1` excludes phrases entirely.
+
+@warning Throws if the query is malformed.
+*/
+PhraseQuery parse_phrase_query(const std::string& query);
+
+/**
+Inverted index from the words of entries to the entries that contain them
+
+Entries are split into words at white space, and words are stored in lowercase.
+A pattern is matched against each distinct word once, rather than against each entry.
+
+@code
+speller::PhraseIndex index(store, "tr");
+std::vector<size_t> ids = index.find(speller::parse_phrase_query("2:güreşi"), budget, page);
+@endcode
+*/
+class PhraseIndex {
+public:
+    /// Split each entry of @a store into words
+    /// @warning Throws if locale does not exist.
+    PhraseIndex(const EntryStore& store, const std::string& locale_name);
+
+    /// Identifiers of the entries that satisfy @a query, in ascending order
+    /// @note Each distinct word tested against a pattern, each occurrence of a matching word,
+    /// and each entry tested against the number of words are accounted as candidates.
+    /// @note If the budget runs out on the last word filter, the entries it found so far are still returned.
+    /// @warning Throws if a pattern is not a valid regex.
+    std::vector<size_t> find(const PhraseQuery& query, QueryBudget& budget, ResultPage& page) const;
+
+    /// Number of words in the entry
+    /// @warning Throws if @a entry_id is out of range.
+    size_t get_num_words(size_t entry_id) const&;
+
+    /// Number of distinct words in all entries
+    size_t get_num_distinct_words() const noexcept;
+
+    const std::string& get_locale_name() const& noexcept;
+
+private:
+    struct Posting {
+        size_t entry_id;
+        // zero-based position of the word in the entry
+        size_t position;
+    };
+
+    // identifiers of the entries that satisfy filter, in ascending order
+    std::vector<size_t> find_entries(const PhraseWordFilter& filter, QueryBudget& budget) const;
+
+    std::string locale_name;
+    // distinct lowercase words in ascending order
+    std::vector<std::string> words;
+    // postings of words[i] are in [posting_offsets[i], posting_offsets[i + 1])
+    std::vector<size_t> posting_offsets;
+    std::vector<Posting> postings;
+    std::vector<size_t> num_words;
+};
+
+} // namespace speller
+
+#endif // SPELLER_PHRASE_INDEX_HPP
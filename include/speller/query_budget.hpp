@@ -0,0 +1,116 @@
+#ifndef SPELLER_QUERY_BUDGET_HPP
+#define SPELLER_QUERY_BUDGET_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <limits>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+/// Limits applied to each query
+struct QueryLimits {
+    /// No limit on a count
+    static constexpr size_t unlimited = std::numeric_limits<size_t>::max();
+
+    /// Maximum duration of a query, zero for no limit
+    std::chrono::milliseconds timeout { 0 };
+
+    /// Maximum number of candidates to examine
+    size_t max_candidates = unlimited;
+
+    /// Maximum number of results to return
+    size_t max_results = unlimited;
+};
+
+/**
+Remaining budget of a single query
+
+Search loops check the budget cooperatively and stop early when it is exhausted,
+so that partial results can be returned and flagged as truncated.
+The query can also be cancelled from another thread.
+
+@code
+QueryBudget budget(limits);
+for (const auto& candidate : candidates) {
+    if (!budget.visit_candidates()) {
+        break;
+    }
+    if (matches(candidate) && !budget.add_result()) {
+        break;
+    }
+    ...
+}
+@endcode
+*/
+class QueryBudget {
+public:
+    using clock = std::chrono::steady_clock;
+
+    /// Reason of stopping a query early
+    enum class Truncation {
+        none,
+        timeout,
+        max_candidates,
+        max_results,
+        cancelled,
+    };
+
+    /// Unlimited budget
+    QueryBudget() noexcept;
+
+    /// Start the clock with given limits
+    explicit QueryBudget(const QueryLimits& limits) noexcept;
+
+    QueryBudget(const QueryBudget&) = delete;
+    QueryBudget& operator=(const QueryBudget&) = delete;
+
+    /// Account for candidates about to be examined
+    /// @return false if the budget is exhausted and scanning must stop
+    /// @note The clock is read once every many candidates, so that cheap tests are not slowed down.
+    bool visit_candidates(size_t count = 1) noexcept;
+
+    /// Account for a single candidate whose test is expensive, e.g. a regex match, reading the clock every time
+    /// @return false if the budget is exhausted and scanning must stop
+    /// @note A single test cannot be interrupted, so it can still exceed the timeout on its own.
+    bool visit_expensive_candidate() noexcept;
+
+    /// Account for a result about to be added
+    /// @return false if the result must be discarded and scanning must stop
+    /// @note Results of candidates examined before the budget was exhausted are still accepted, up to the maximum number of results.
+    bool add_result() noexcept;
+
+    /// Request the query to stop at the next check
+    /// @note Safe to call from any thread.
+    void cancel() noexcept;
+
+    /// Number of candidates accounted so far
+    size_t get_num_candidates() const noexcept;
+
+    /// Whether the query was stopped before completion
+    bool is_truncated() const noexcept;
+
+    /// Reason of stopping the query before completion
+    Truncation get_truncation() const noexcept;
+
+    /// Human readable reason of stopping the query before completion
+    const char* get_truncation_reason() const noexcept;
+
+private:
+    bool truncate(Truncation reason) noexcept;
+
+    QueryLimits limits;
+    clock::time_point deadline;
+    size_t num_candidates = 0;
+    size_t num_results = 0;
+    size_t next_clock_check = 0;
+    std::atomic<bool> cancelled = false;
+    Truncation truncation = Truncation::none;
+};
+
+} // namespace speller
+
+#endif // SPELLER_QUERY_BUDGET_HPP
@@ -0,0 +1,124 @@
+#ifndef SPELLER_QUERY_PLANNER_HPP
+#define SPELLER_QUERY_PLANNER_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <limits>
+#include <string>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Headers
+#include <speller/entry_statistics.hpp>
+#include <speller/letter_matrix.hpp>
+#include <speller/sorted_key_index.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+/// Constraints that every match of a query satisfies, regardless of the mode the query is written in
+struct QueryShape {
+    /// No limit on the number of letters
+    static constexpr size_t unlimited = std::numeric_limits<size_t>::max();
+
+    /// Minimum number of letters
+    size_t min_length = 0;
+
+    /// Maximum number of letters
+    size_t max_length = unlimited;
+
+    /// Minimum number of occurrences of each letter, indexed by #LetterId
+    std::vector<size_t> required_letter_counts;
+
+    /// Lowercase text that every match starts with
+    std::string anchored_prefix;
+
+    /// Lowercase text that every match ends with
+    std::string anchored_suffix;
+
+    /// Whether #anchored_prefix is the whole lowercase form of every match
+    bool is_exact = false;
+
+    /// Allowed letters at each position from the start, with every bit set where any letter is allowed
+    std::vector<LetterMask> position_masks;
+
+    /// Letters of #required_letter_counts that fit in a #LetterMask
+    LetterMask get_required_letters_mask() const noexcept;
+};
+
+/// Shape of a pattern of Dictionary::match_wildcard
+/// @note Lengths and letters are only known for patterns without regex special characters other than wildcards.
+/// @warning Throws if locale does not exist or @a pattern is not valid UTF-8.
+QueryShape shape_from_wildcard(const std::string& pattern, const std::string& locale_name);
+
+/// Shape of a query of Dictionary::find_anagrams
+/// @warning Throws if locale does not exist or @a query is not valid UTF-8.
+QueryShape shape_from_anagram(const std::string& query, const std::string& locale_name);
+
+/// Shape of a query of Dictionary::find_letter_set
+/// @warning Throws if locale does not exist.
+QueryShape shape_from_letter_set(const LetterSetQuery& query, const std::string& locale_name);
+
+/// Source of the candidates of a query
+enum class AccessPath {
+    /// Every entry
+    full_scan,
+    /// Entries whose key is QueryShape::anchored_prefix, from Dictionary::get_key_index
+    exact_key,
+    /// Entries whose key starts with QueryShape::anchored_prefix, from Dictionary::get_key_index
+    key_prefix,
+    /// Entries whose key ends with QueryShape::anchored_suffix, from Dictionary::get_suffix_index
+    key_suffix,
+    /// Entries within the length range that contain the required letters, from Dictionary::get_statistics
+    length_mask,
+    /// Columns of the words of the length, from Dictionary::get_letter_matrix
+    letter_matrix,
+};
+
+/// Indexes that a plan can use, nullptr for those that are not built or do not apply to the query
+struct PlanningIndexes {
+    size_t num_entries = 0;
+
+    const EntryStatistics* statistics = nullptr;
+
+    const SortedKeyIndex* key_index = nullptr;
+
+    /// Only if letters are reversed independently of their neighbors
+    const SortedKeyIndex* suffix_index = nullptr;
+
+    /// Only if it answers the query on its own, i.e. for letter set queries
+    const LetterMatrix* letter_matrix = nullptr;
+};
+
+/// Access paths whose candidates are intersected, with the cost expected of them
+struct QueryPlan {
+    QueryShape shape;
+
+    /// In the order they are intersected, starting from the smallest
+    std::vector<AccessPath> access_paths;
+
+    /// Number of candidates expected to be tested against the query
+    double estimated_candidates = 0;
+
+    /// Expected cost in units of testing a single candidate
+    double estimated_cost = 0;
+};
+
+/**
+Choose the cheapest combination of access paths for a query of given shape
+
+Sizes of key ranges are counted exactly, and the size of the intersection of several access paths is estimated
+as if they were independent.
+Entries that contain the required letters are estimated from the fraction of entries that contain each letter.
+Reading an identifier of a key range, testing a letter mask or a letter matrix cell is much cheaper than testing a candidate,
+so that access paths are combined when they narrow down the candidates enough.
+
+@warning Throws if locale does not exist.
+*/
+QueryPlan plan_query(QueryShape shape, const PlanningIndexes& indexes, const std::string& locale_name);
+
+/// Human readable access paths of @a plan, e.g. `key prefix "ka" & key suffix "r"`
+std::string describe_plan(const QueryPlan& plan, const std::string& locale_name);
+
+} // namespace speller
+
+#endif // SPELLER_QUERY_PLANNER_HPP
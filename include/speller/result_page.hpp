@@ -0,0 +1,82 @@
+#ifndef SPELLER_RESULT_PAGE_HPP
+#define SPELLER_RESULT_PAGE_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <cstddef>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Headers
+#include <speller/query_budget.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+/**
+Window of matches to materialize out of all matches of a query
+
+Matches are accounted in a stable order, i.e. dictionary order for scans and rank order for ranked queries,
+so that consecutive pages of the same query neither overlap nor skip a match.
+Scanning can stop as soon as the page is complete, unless only the number of matches is requested.
+
+@code
+ResultPage page(offset, limit);
+for (const auto& candidate : candidates) {
+    if (page.is_complete()) {
+        page.stop();
+        break;
+    }
+    if (matches(candidate) && page.take()) {
+        ...
+    }
+}
+@endcode
+*/
+class ResultPage {
+public:
+    /// No limit on the number of matches
+    static constexpr size_t unlimited = QueryLimits::unlimited;
+
+    /// All matches
+    ResultPage() noexcept;
+
+    /// Matches in [@a offset, @a offset + @a limit), or only their count if @a count_only is set
+    ResultPage(size_t offset, size_t limit, bool count_only = false) noexcept;
+
+    /// Account for the next match in order
+    /// @return true if the match is in the page and should be materialized
+    bool take() noexcept;
+
+    /// Whether no further match can be in the page, so that scanning can stop
+    /// @note Never true when only the number of matches is requested.
+    bool is_complete() const noexcept;
+
+    /// Record that scanning stopped before all candidates were examined
+    void stop() noexcept;
+
+    /// Number of matches accounted so far
+    size_t get_num_matches() const noexcept;
+
+    /// Whether #get_num_matches is the total number of matches rather than a lower bound
+    /// @note The number of matches is also a lower bound if the QueryBudget of the query is truncated.
+    bool is_num_matches_exact() const noexcept;
+
+    /// Index of the first match in the page
+    size_t get_offset() const noexcept;
+
+    /// Maximum number of matches in the page
+    size_t get_limit() const noexcept;
+
+    /// Whether matches are only counted and never materialized
+    bool is_count_only() const noexcept;
+
+private:
+    size_t offset;
+    size_t limit;
+    bool count_only;
+    size_t num_matches = 0;
+    bool stopped = false;
+};
+
+} // namespace speller
+
+#endif // SPELLER_RESULT_PAGE_HPP
@@ -0,0 +1,70 @@
+#ifndef SPELLER_SEARCH_HPP
+#define SPELLER_SEARCH_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <regex>
+#include <string>
+#include <string_view>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Headers
+#include <speller/entry_store.hpp>
+#include <speller/query_budget.hpp>
+#include <speller/result_page.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+/**
+Regex of given pattern, rejecting patterns whose single match can take exponential time
+
+A group that contains an unbounded quantifier and is itself repeated without bound, e.g. `(a+)*`,
+backtracks exponentially on an entry that almost matches.
+Such a test cannot be interrupted by the query budget, which is only checked between entries.
+
+@warning Throws if @a pattern is not a valid regex or has nested unbounded quantifiers.
+*/
+std::regex compile_regex(const std::string& pattern);
+
+/// Entries that contain a match of @a rgx, in dictionary order
+std::vector<EntryHandle> search_regex(const EntryStore& store, const std::regex& rgx, QueryBudget& budget, ResultPage& page);
+
+/// Entries that match @a rgx as a whole, in dictionary order
+std::vector<EntryHandle> match_regex(const EntryStore& store, const std::regex& rgx, QueryBudget& budget, ResultPage& page);
+
+/**
+Regex equivalent of a wildcard pattern, to be matched against lowercase entries
+
+The pattern is converted to lowercase, and the following characters are specially treated.
+
+- `*` matches one or more letters or spaces
+- `?` matches exactly one letter or space
+
+@see #match_regex
+@warning Throws if the converted pattern is rejected by #compile_regex.
+*/
+std::regex wildcard_to_regex(const std::string& pattern, const std::string& locale_name);
+
+/**
+Longest prefix of a wildcard pattern that every match starts with
+
+The prefix ends before the first wildcard or regex special character.
+It is empty if the pattern contains an alternative (`|`).
+*/
+std::string_view get_literal_prefix(std::string_view pattern);
+
+/**
+Longest suffix of a wildcard pattern that every match ends with
+
+The suffix starts after the last wildcard or regex special character, or after the escaped character that follows it.
+It is empty if the pattern contains an alternative (`|`).
+*/
+std::string_view get_literal_suffix(std::string_view pattern);
+
+/// Entries converted to lowercase in given locale, with the same identifiers
+EntryStore to_lowercase(const EntryStore& store, const std::string& locale_name);
+
+} // namespace speller
+
+#endif // SPELLER_SEARCH_HPP
@@ -0,0 +1,130 @@
+#ifndef SPELLER_SHARD_HPP
+#define SPELLER_SHARD_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Headers
+#include <speller/dictionary.hpp>
+#include <speller/query_budget.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+/// Query mode of a shard, named after the executable with the same syntax
+enum class ShardMode {
+    regex,
+    search,
+    search_any,
+    letter_set,
+};
+
+/// @warning Throws if @a name is not one of `regex`, `search`, `search_any` or `letter_set`.
+ShardMode shard_mode_from_string(const std::string& name);
+
+/// How dictionary entries are distributed among shards
+enum class ShardStrategy {
+    /// By a hash of the entry, for an even distribution
+    hash,
+    /// By number of letters, so that queries of a fixed length are answered by a single shard
+    length,
+};
+
+/// @warning Throws if @a name is neither `hash` nor `length`.
+ShardStrategy shard_strategy_from_string(const std::string& name);
+
+/// Distribution of dictionary entries among shards
+struct ShardLayout {
+    /// Returned when any shard may contain a match
+    static constexpr size_t all_shards = static_cast<size_t>(-1);
+
+    size_t num_shards = 1;
+    ShardStrategy strategy = ShardStrategy::length;
+    std::string locale_name;
+
+    /// Shard that holds @a entry
+    size_t get_shard_index(std::string_view entry) const;
+
+    /// Shard that holds every match of @a query, or #all_shards
+    size_t get_query_shard_index(ShardMode mode, const std::string& query) const;
+};
+
+/// Query sent to a shard
+struct ShardRequest {
+    std::string query;
+
+    /// Number of matches to return, counted from the first match of the shard
+    size_t max_matches = QueryLimits::unlimited;
+
+    /// Whether matches are only counted
+    bool count_only = false;
+
+    QueryLimits limits;
+};
+
+/// Matches of a shard
+struct ShardResponse {
+    /// Error message of a failed query, empty on success
+    std::string error;
+
+    size_t num_matches = 0;
+
+    bool is_num_matches_exact = true;
+
+    /// Reason of stopping the query early, empty if not truncated
+    std::string truncation_reason;
+
+    /// Identifier of each match in the whole dictionary with its output line, in dictionary order
+    std::vector<std::pair<size_t, std::string>> matches;
+};
+
+/// Binary form of a #ShardRequest for a process of the same executable
+std::string encode_shard_request(const ShardRequest& request);
+
+/// @warning Throws if @a message is truncated.
+ShardRequest decode_shard_request(std::string_view message);
+
+/// Binary form of a #ShardResponse for a process of the same executable
+std::string encode_shard_response(const ShardResponse& response);
+
+/// @warning Throws if @a message is truncated.
+ShardResponse decode_shard_response(std::string_view message);
+
+/**
+Entries of a single shard with the index of its query mode
+
+Only the entries of the shard are kept in memory, so that a dictionary can be spread over processes.
+
+@code
+speller::ShardLayout layout { 4, speller::ShardStrategy::length, "tr" };
+speller::Shard shard("tr.txt", layout, 0, speller::ShardMode::search_any);
+speller::ShardResponse response = shard.answer(request);
+@endcode
+*/
+class Shard {
+public:
+    /// Read entries of the shard from a speller file, one line at a time
+    /// @warning Throws if file does not exist or is not valid UTF-8.
+    Shard(const std::filesystem::path& speller_path, const ShardLayout& layout, size_t shard_index, ShardMode mode);
+
+    /// Answer a query in the mode of the shard
+    /// @note Errors of the query, e.g. an invalid regex, are reported in the response.
+    ShardResponse answer(const ShardRequest& request) const;
+
+    /// Number of entries in the shard
+    size_t size() const noexcept;
+
+private:
+    ShardMode mode;
+    std::vector<size_t> global_ids;
+    Dictionary dictionary;
+};
+
+} // namespace speller
+
+#endif // SPELLER_SHARD_HPP
@@ -0,0 +1,94 @@
+#ifndef SPELLER_SORTED_KEY_INDEX_HPP
+#define SPELLER_SORTED_KEY_INDEX_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <cstdint>
+#include <iosfwd>
+#include <regex>
+#include <string>
+#include <string_view>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Headers
+#include <speller/entry_store.hpp>
+#include <speller/front_coded_strings.hpp>
+#include <speller/query_budget.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+/**
+Distinct lowercase entries in ascending order, with the identifiers of the entries of each
+
+Entries that differ only in case share a key.
+Keys are front coded, so that the long prefixes shared by consecutive words are stored once.
+Exact and prefix lookups are binary searches, and any other pattern is tested once per distinct key.
+Keys of a KeyDirection::reversed index have their letters in reverse order, so that suffixes are looked up as prefixes.
+
+@code
+speller::SortedKeyIndex index(store, "tr");
+std::vector<size_t> ids = index.find_prefix("tasdik");
+speller::SortedKeyIndex suffix_index(store, "tr", speller::SortedKeyIndex::KeyDirection::reversed);
+std::vector<size_t> suffix_ids = suffix_index.find_prefix(speller::reverse_letters("siz", "tr"));
+@endcode
+*/
+class SortedKeyIndex {
+public:
+    /// Order of the letters of keys
+    enum class KeyDirection {
+        /// As written
+        forward,
+        /// Reversed as in speller::reverse_letters, keeping multi-character letters intact
+        reversed,
+    };
+
+    /// @warning Throws if locale does not exist or @a store has more entries than std::uint32_t can identify.
+    SortedKeyIndex(const EntryStore& store, const std::string& locale_name, KeyDirection direction = KeyDirection::forward);
+
+    /// Read index written by #save
+    /// @warning Throws if the stream does not contain an index written by #save.
+    static SortedKeyIndex load(std::istream& is);
+
+    /// Write index in a binary format
+    /// @warning Throws if writing fails.
+    void save(std::ostream& os) const;
+
+    const FrontCodedStrings& get_keys() const& noexcept;
+
+    /// Append identifiers of the entries with the key at given index, in ascending order
+    void append_entry_ids(size_t key_index, std::vector<size_t>& ids) const;
+
+    /// Identifiers of the entries whose key is @a key, in ascending order
+    std::vector<size_t> find(std::string_view key) const;
+
+    /// Identifiers of the entries whose key starts with @a prefix, in ascending order
+    std::vector<size_t> find_prefix(std::string_view prefix) const;
+
+    /// Number of entries whose key starts with @a prefix, decoding at most two blocks of keys to find the range
+    size_t count_prefix(std::string_view prefix) const;
+
+    /**
+    Identifiers of the entries whose key matches @a rgx as a whole, in ascending order
+
+    @param literal_prefix Prefix of every match, so that only the keys that start with it are tested
+    @note Each tested key is accounted as a candidate.
+    @return Matches found until @a budget is exhausted
+    */
+    std::vector<size_t> match(const std::regex& rgx, std::string_view literal_prefix, QueryBudget& budget) const;
+
+    /// Number of bytes held, excluding the object itself
+    size_t get_memory_size() const noexcept;
+
+private:
+    SortedKeyIndex() = default;
+
+    FrontCodedStrings keys;
+    // entry_ids[id_offsets[i], id_offsets[i + 1]) have keys[i]
+    std::vector<std::uint32_t> id_offsets;
+    std::vector<std::uint32_t> entry_ids;
+};
+
+} // namespace speller
+
+#endif // SPELLER_SORTED_KEY_INDEX_HPP
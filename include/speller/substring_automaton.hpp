@@ -0,0 +1,78 @@
+#ifndef SPELLER_SUBSTRING_AUTOMATON_HPP
+#define SPELLER_SUBSTRING_AUTOMATON_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Headers
+#include <speller/alphabet.hpp>
+#include <speller/entry_store.hpp>
+#include <speller/letter.hpp>
+#include <speller/query_budget.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+/**
+Aho-Corasick automaton that finds any number of literal patterns in a single pass over the entries
+
+Patterns and entries are split into letters in given locale, and letters in the alphabet are compared by
+Alphabet::get_letter_id, so that matching disregards case.
+A letter that is not in the alphabet only matches itself.
+Every state has a transition for every distinct letter of the patterns, so that each letter of an entry costs a single lookup.
+
+@code
+speller::SubstringAutomaton automaton({ "lik", "siz", "kalem" }, "tr");
+std::vector<std::vector<size_t>> ids = automaton.find_all(store, budget);
+@endcode
+*/
+class SubstringAutomaton {
+public:
+    /// @warning Throws if locale does not exist, or any pattern is empty or not valid UTF-8.
+    SubstringAutomaton(const std::vector<std::string>& patterns, std::string locale_name);
+
+    /// Number of patterns, including duplicates
+    size_t get_num_patterns() const noexcept;
+
+    /// Number of states, including the initial state
+    size_t get_num_states() const noexcept;
+
+    /**
+    Identifiers of the entries that contain each pattern, in ascending order
+
+    Each entry is split into letters once, regardless of the number of patterns.
+
+    @note Each entry is accounted as a candidate, and each entry of each pattern as a result.
+    @return Entries found for each pattern in the order of the patterns, until @a budget is exhausted
+    */
+    std::vector<std::vector<size_t>> find_all(const EntryStore& store, QueryBudget& budget) const;
+
+private:
+    // returned by get_symbol for letters that do not occur in any pattern
+    static constexpr std::uint32_t no_symbol = static_cast<std::uint32_t>(-1);
+
+    // column of the letter in transitions
+    std::uint32_t get_symbol(Letter letter) const;
+
+    std::string locale_name;
+    const Alphabet* alphabet;
+    size_t num_patterns;
+    // letters of the alphabet come first, followed by the other letters of the patterns
+    std::unordered_map<std::string, std::uint32_t> foreign_symbols;
+    size_t num_symbols;
+    // transitions[state * num_symbols + symbol], with failures already followed
+    std::vector<std::uint32_t> transitions;
+    // nearest state along failure links that completes a pattern, zero if none
+    std::vector<std::uint32_t> output_links;
+    // output_patterns[output_offsets[state], output_offsets[state + 1]) end at state
+    std::vector<std::uint32_t> output_offsets;
+    std::vector<std::uint32_t> output_patterns;
+};
+
+} // namespace speller
+
+#endif // SPELLER_SUBSTRING_AUTOMATON_HPP
@@ -0,0 +1,39 @@
+#ifndef SPELLER_UTF8_HPP
+#define SPELLER_UTF8_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <string_view>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+/**
+Number of leading ASCII characters in @a sw
+
+Blocks of 32 (AVX2) or 16 (SSE2) characters are checked at once where supported,
+and 8 characters at once otherwise.
+
+@see SPELLER_ENABLE_AVX2 build option
+*/
+size_t get_ascii_prefix_size(std::string_view sw) noexcept;
+
+/// Whether every character in @a sw is ASCII
+bool is_ascii(std::string_view sw) noexcept;
+
+/**
+Offset of the first character that does not belong to a valid UTF-8 sequence
+
+Overlong encodings, surrogates and code points above U+10FFFF are invalid.
+ASCII blocks are skipped with #get_ascii_prefix_size.
+
+@return Size of @a sw if it is entirely valid
+*/
+size_t find_invalid_utf8(std::string_view sw) noexcept;
+
+/// @warning Throws if @a sw is not valid UTF-8, reporting the line and byte of the first invalid character.
+void validate_utf8(std::string_view sw);
+
+} // namespace speller
+
+#endif // SPELLER_UTF8_HPP
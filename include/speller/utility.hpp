@@ -5,20 +5,82 @@
 // Standard Headers
 #include <filesystem>
 #include <iosfwd>
+#include <map>
 #include <regex>
 #include <string>
+#include <string_view>
 #include <vector>
 ////////////////////////////////////////////////////////////////////////////////
 
 namespace util {
 
+/// Command line arguments split into positional arguments and `--name=value` options
+struct Arguments {
+    /// Arguments that do not start with `--`, excluding program name
+    std::vector<std::string> positional;
+
+    /// Value of each option, empty for `--name` without a value
+    std::map<std::string, std::string> options;
+};
+
+Arguments parse_arguments(int argc, const char* const* argv);
+
+/// Whether an option is given, with or without a value
+bool has_option(const Arguments& arguments, const std::string& name);
+
+/// Value of an option converted to the type of @a default_value
+/// @warning Throws if the value cannot be converted, including a negative value for an unsigned type.
+template <typename T>
+T get_option(const Arguments& arguments, const std::string& name, T default_value);
+
 void enable_exceptions(std::istream& is);
 
 std::string file_to_string(const std::filesystem::path& filename);
 
 std::vector<std::string> file_to_vector(const std::filesystem::path& filename);
 
-std::vector<std::string> get_all_matches(const std::string& str, const std::regex& rgx);
+/// Matched parts of @a str, pointing into @a str
+std::vector<std::string_view> get_all_matches(const std::string& str, const std::regex& rgx);
+
+std::vector<std::string_view> get_all_matches(std::string&& str, const std::regex& rgx) = delete;
+
+/**
+Output buffer written to a file descriptor with a single `write(2)` per flush
+
+Bypasses iostream formatting for large outputs.
+Flushes automatically when full and on destruction.
+
+@warning Flush standard streams that write to the same file descriptor beforehand to preserve order.
+*/
+class OutputBuffer {
+public:
+    /// Default buffer size in bytes
+    static constexpr size_t default_capacity = 1 << 20;
+
+    /// Standard output
+    static constexpr int stdout_fd = 1;
+
+    explicit OutputBuffer(int fd = stdout_fd, size_t capacity = default_capacity);
+
+    OutputBuffer(const OutputBuffer&) = delete;
+    OutputBuffer& operator=(const OutputBuffer&) = delete;
+
+    ~OutputBuffer();
+
+    OutputBuffer& operator<<(std::string_view sw);
+
+    OutputBuffer& operator<<(char ch);
+
+    OutputBuffer& operator<<(size_t value);
+
+    /// Write buffered content
+    /// @warning Throws if writing fails.
+    void flush();
+
+private:
+    int fd;
+    std::string buffer;
+};
 
 } // namespace util
 
@@ -29,19 +91,79 @@ std::vector<std::string> get_all_matches(const std::string& str, const std::rege
 ////////////////////////////////////////////////////////////////////////////////
 // Standard Headers
 #include <algorithm>
+#include <cerrno>
+#include <charconv>
 #include <filesystem>
 #include <fstream>
 #include <istream>
 #include <iterator>
+#include <limits>
+#include <map>
 #include <regex>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
 #include <vector>
 ////////////////////////////////////////////////////////////////////////////////
+// System Headers
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+////////////////////////////////////////////////////////////////////////////////
 
 namespace util {
 
+inline Arguments parse_arguments(int argc, const char* const* argv)
+{
+    Arguments arguments;
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        static const std::string option_prefix = "--";
+        if (arg.compare(0, option_prefix.size(), option_prefix) != 0) {
+            arguments.positional.push_back(arg);
+            continue;
+        }
+        const std::string::size_type pos = arg.find('=');
+        if (pos == std::string::npos) {
+            arguments.options[arg.substr(option_prefix.size())] = "";
+        } else {
+            arguments.options[arg.substr(option_prefix.size(), pos - option_prefix.size())] = arg.substr(pos + 1);
+        }
+    }
+    return arguments;
+}
+
+inline bool has_option(const Arguments& arguments, const std::string& name)
+{
+    return arguments.options.count(name) != 0;
+}
+
+template <typename T>
+T get_option(const Arguments& arguments, const std::string& name, T default_value)
+{
+    const auto it = arguments.options.find(name);
+    if (it == arguments.options.end()) {
+        return default_value;
+    }
+    std::istringstream iss(it->second);
+    T value;
+    // stream extraction wraps negative values around for unsigned types
+    if constexpr (std::is_unsigned_v<T>) {
+        if (it->second.find('-') != std::string::npos) {
+            throw std::invalid_argument("Invalid value for option --" + name + ": " + it->second);
+        }
+    }
+    if (!(iss >> value) || !iss.eof()) {
+        throw std::invalid_argument("Invalid value for option --" + name + ": " + it->second);
+    }
+    return value;
+}
+
 inline void enable_exceptions(std::istream& is)
 {
     is.exceptions(std::ios::badbit | std::ios::failbit);
@@ -71,14 +193,74 @@ inline std::vector<std::string> file_to_vector(const std::filesystem::path& file
     return results;
 }
 
-inline std::vector<std::string> get_all_matches(const std::string& str, const std::regex& rgx)
+inline std::vector<std::string_view> get_all_matches(const std::string& str, const std::regex& rgx)
 {
-    std::vector<std::string> results;
-    std::copy(std::sregex_token_iterator(str.begin(), str.end(), rgx),
-        std::sregex_token_iterator(), std::back_inserter(results));
+    std::vector<std::string_view> results;
+    std::transform(std::sregex_iterator(str.begin(), str.end(), rgx), std::sregex_iterator(),
+        std::back_inserter(results),
+        [&str](const std::smatch& match) { return std::string_view(str).substr(match.position(), match.length()); });
     return results;
 }
 
+inline OutputBuffer::OutputBuffer(int fd_value, size_t capacity)
+    : fd(fd_value)
+{
+    buffer.reserve(capacity);
+}
+
+inline OutputBuffer::~OutputBuffer()
+{
+    try {
+        flush();
+    } catch (...) {
+        // destructor must not throw
+    }
+}
+
+inline OutputBuffer& OutputBuffer::operator<<(std::string_view sw)
+{
+    if (buffer.size() + sw.size() > buffer.capacity()) {
+        flush();
+    }
+    buffer.append(sw);
+    return *this;
+}
+
+inline OutputBuffer& OutputBuffer::operator<<(char ch)
+{
+    return *this << std::string_view(&ch, 1);
+}
+
+inline OutputBuffer& OutputBuffer::operator<<(size_t value)
+{
+    char digits[std::numeric_limits<size_t>::digits10 + 1];
+    const auto [end, ec] = std::to_chars(std::begin(digits), std::end(digits), value);
+    return *this << std::string_view(digits, end - digits);
+}
+
+inline void OutputBuffer::flush()
+{
+    const char* data = buffer.data();
+    size_t remaining = buffer.size();
+    while (remaining != 0) {
+#ifdef _WIN32
+        const auto written = ::_write(fd, data, static_cast<unsigned int>(remaining));
+#else
+        const auto written = ::write(fd, data, remaining);
+#endif
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            buffer.clear();
+            throw std::system_error(errno, std::generic_category(), "Failed to write output");
+        }
+        data += written;
+        remaining -= static_cast<size_t>(written);
+    }
+    buffer.clear();
+}
+
 } // namespace util
 
 #endif // SPELLER_UTILITY_HPP
@@ -8,17 +8,25 @@
 #include <vector>
 ////////////////////////////////////////////////////////////////////////////////
 // User Defined Headers
+#include <speller/alphabet.hpp>
 #include <speller/letter.hpp>
 #include <speller/locale.hpp>
 ////////////////////////////////////////////////////////////////////////////////
 
 namespace speller {
 
-/// Access letters of a string in given locale
-/// @see Locale
+/**
+Access letters of a string in given locale
+
+Splitting is specialized for the encoding of the alphabet.
+A code point that does not exist in the alphabet is a single letter, regardless of its size.
+When every letter is a single character, letters of ASCII strings are not stored at all.
+
+@see Alphabet::Encoding
+*/
 class Word {
 public:
-    /// @warning Throws if locale does not exist.
+    /// @warning Throws if locale does not exist or @a str is not valid UTF-8.
     explicit Word(std::string str, std::string locale_name = Locale::default_locale_name);
 
     /// Implicit conversion to std::string
@@ -43,9 +51,23 @@ public:
 private:
     std::string str;
     std::string locale_name;
-    std::vector<Letter> letters;
+    const Alphabet* alphabet;
+    // start of each letter followed by the end of the string, empty if every character is a letter
+    std::vector<size_t> letter_offsets;
 };
 
+/// Similar to Word::tolower, without splitting @a str into a #Word beforehand
+/// @warning Throws if locale does not exist or @a str is not valid UTF-8.
+std::string to_lowercase(std::string_view str, const std::string& locale_name = Locale::default_locale_name);
+
+/// Similar to Word::toupper, without splitting @a str into a #Word beforehand
+/// @warning Throws if locale does not exist or @a str is not valid UTF-8.
+std::string to_uppercase(std::string_view str, const std::string& locale_name = Locale::default_locale_name);
+
+/// Letters of @a str in reverse order, each letter kept as is
+/// @warning Throws if locale does not exist or @a str is not valid UTF-8.
+std::string reverse_letters(std::string_view str, const std::string& locale_name = Locale::default_locale_name);
+
 } // namespace speller
 
 #endif // SPELLER_WORD_HPP
@@ -15,25 +15,14 @@
 #include <type_traits>
 #include <vector>
 ////////////////////////////////////////////////////////////////////////////////
+// User Defined Headers
+#include <speller/utf8.hpp>
+////////////////////////////////////////////////////////////////////////////////
 
 namespace speller {
 
-static const std::set<char> regex_special_characters = {
-    '\\',
-    '^',
-    '$',
-    '.',
-    '|',
-    '?',
-    '*',
-    '+',
-    '(',
-    ')',
-    '[',
-    ']',
-    '{',
-    '}',
-};
+// constant initialized, so that alphabets can be created during static initialization
+static constexpr std::string_view regex_special_characters = R"(\^$.|?*+()[]{})";
 
 template <typename Container>
 static std::string get_regex_group_str(const Container& alternative_regexes)
@@ -46,9 +35,9 @@ static std::string get_regex_group_str(const Container& alternative_regexes)
     auto it = std::cbegin(alternative_regexes);
     auto get_current_regex_string = [&it]() {
         std::string_view sw;
-        if constexpr (std::is_same_v<Container::value_type, Letter>) {
+        if constexpr (std::is_same_v<typename Container::value_type, Letter>) {
             sw = it->string_view();
-        } else if constexpr (std::is_same_v<Container::value_type, std::pair<const size_t, std::string>>) {
+        } else if constexpr (std::is_same_v<typename Container::value_type, std::pair<const size_t, std::string>>) {
             sw = it->second;
         } else {
             sw = *it;
@@ -74,15 +63,36 @@ Alphabet::Alphabet(const std::vector<std::string>& lowercase_letters, const std:
         throw std::invalid_argument(oss.str());
     }
     const size_t letters_size = lowercase_letters.size();
+    // letter identifiers must fit
+    if (letters_size >= foreign_letter_id) {
+        throw std::invalid_argument("Alphabet contains too many letters: " + std::to_string(letters_size));
+    }
+    // valid UTF-8
+    for (const auto& ref : { std::cref(lowercase_letters), std::cref(uppercase_letters) }) {
+        for (const std::string& str : ref.get()) {
+            if (str.empty() || find_invalid_utf8(str) != str.size()) {
+                throw std::invalid_argument("Letter is empty or not valid UTF-8: " + str);
+            }
+        }
+    }
     // no regex special character
     for (const auto& ref : { std::cref(lowercase_letters), std::cref(uppercase_letters) }) {
         for (const std::string& str : ref.get()) {
-            if (std::any_of(str.begin(), str.end(), [](char ch) { return regex_special_characters.count(ch); })) {
+            if (str.find_first_of(regex_special_characters) != std::string::npos) {
                 throw std::invalid_argument("Letter contains regex special character: " + str);
             }
         }
     }
 
+    // single character tables map every other character to itself
+    byte_letter_ids.fill(foreign_letter_id);
+    for (size_t ch = 0; ch < byte_tolower_table.size(); ch++) {
+        byte_tolower_table[ch] = static_cast<char>(ch);
+        byte_toupper_table[ch] = static_cast<char>(ch);
+    }
+    lowercase_letters_by_id = lowercase_letters;
+    uppercase_letters_by_id = uppercase_letters;
+
     for (size_t i = 0; i < letters_size; i++) {
         const std::string& lower_str = lowercase_letters[i];
         const std::string& upper_str = uppercase_letters[i];
@@ -104,34 +114,58 @@ Alphabet::Alphabet(const std::vector<std::string>& lowercase_letters, const std:
             throw std::invalid_argument("Uppercase letter is duplicate: " + upper_str);
         }
 
-        // tolower_map
-        tolower_map.insert({ upper_hash, lower_hash });
+        // letter identifiers
+        const LetterId id = static_cast<LetterId>(i);
+        letter_id_map.insert({ lower_hash, id });
+        letter_id_map.insert({ upper_hash, id });
 
-        // toupper_map
-        toupper_map.insert({ lower_hash, upper_hash });
+        // single character tables
+        for (const std::string* str : { &lower_str, &upper_str }) {
+            if (str->size() == 1 && byte_letter_ids[static_cast<unsigned char>(str->front())] == foreign_letter_id) {
+                byte_letter_ids[static_cast<unsigned char>(str->front())] = id;
+            }
+        }
+        if (lower_str.size() == 1 && upper_str.size() == 1) {
+            byte_tolower_table[static_cast<unsigned char>(upper_str.front())] = lower_str.front();
+            byte_toupper_table[static_cast<unsigned char>(lower_str.front())] = upper_str.front();
+        }
+    }
+
+    // choose the simplest splitting strategy that fits every letter
+    max_letter_size = 1;
+    bool all_code_points = true;
+    for (const auto& ref : { std::cref(lowercase_letters), std::cref(uppercase_letters) }) {
+        for (const std::string& str : ref.get()) {
+            max_letter_size = std::max(max_letter_size, str.size());
+            // letters are valid UTF-8, so the first character tells the size of the code point
+            all_code_points = all_code_points && (get_utf8_sequence_size(str.front()) == str.size());
+        }
+    }
+    if (max_letter_size == 1) {
+        encoding = Encoding::single_byte;
+    } else if (all_code_points) {
+        encoding = Encoding::utf8;
+    } else {
+        encoding = Encoding::generic;
     }
 }
 
 Letter Alphabet::tolower(Letter uppercase) const& noexcept
 {
-    const size_t upper_hash = std::hash<Letter>()(uppercase);
-    const auto it = tolower_map.find(upper_hash);
-    if (it == tolower_map.end()) {
+    const LetterId id = get_letter_id(uppercase);
+    if (id == foreign_letter_id) {
         return uppercase;
     }
-    const size_t lower_hash = it->second;
-    return lowercase_hash_map.at(lower_hash);
+    return lowercase_letters_by_id[id];
 }
 
 Letter Alphabet::toupper(Letter lowercase) const& noexcept
 {
-    const size_t lower_hash = std::hash<Letter>()(lowercase);
-    const auto it = toupper_map.find(lower_hash);
-    if (it == toupper_map.end()) {
+    const LetterId id = get_letter_id(lowercase);
+    if (id == foreign_letter_id) {
         return lowercase;
     }
-    const size_t upper_hash = it->second;
-    return uppercase_hash_map.at(upper_hash);
+    return uppercase_letters_by_id[id];
 }
 
 std::set<Letter> Alphabet::get_lowercase_letters() const&
@@ -189,6 +223,67 @@ Letter Alphabet::get_letter_from_hash(size_t hash) const&
     throw std::invalid_argument("Hash not found in the alphabet");
 }
 
+size_t Alphabet::size() const noexcept
+{
+    return lowercase_letters_by_id.size();
+}
+
+LetterId Alphabet::get_letter_id(Letter letter) const& noexcept
+{
+    const std::string_view sw = letter.string_view();
+    if (sw.size() == 1) {
+        return get_byte_letter_id(sw.front());
+    }
+    const size_t hash = std::hash<Letter>()(letter);
+    const auto it = letter_id_map.find(hash);
+    if (it == letter_id_map.end()) {
+        return foreign_letter_id;
+    }
+    return it->second;
+}
+
+Letter Alphabet::get_lowercase_letter(LetterId id) const&
+{
+    return lowercase_letters_by_id.at(id);
+}
+
+Alphabet::LetterClass Alphabet::classify(Letter letter) const& noexcept
+{
+    if (get_letter_id(letter) != foreign_letter_id) {
+        return LetterClass::letter;
+    }
+    const std::string_view sw = letter.string_view();
+    if (sw.size() == 1 && std::string_view(" \t\n\v\f\r").find(sw.front()) != std::string_view::npos) {
+        return LetterClass::space;
+    }
+    return LetterClass::foreign;
+}
+
+Alphabet::Encoding Alphabet::get_encoding() const noexcept
+{
+    return encoding;
+}
+
+size_t Alphabet::get_max_letter_size() const noexcept
+{
+    return max_letter_size;
+}
+
+LetterId Alphabet::get_byte_letter_id(char ch) const noexcept
+{
+    return byte_letter_ids[static_cast<unsigned char>(ch)];
+}
+
+char Alphabet::tolower_byte(char uppercase) const noexcept
+{
+    return byte_tolower_table[static_cast<unsigned char>(uppercase)];
+}
+
+char Alphabet::toupper_byte(char lowercase) const noexcept
+{
+    return byte_toupper_table[static_cast<unsigned char>(lowercase)];
+}
+
 Alphabet alphabet_from_file(const std::string& filename)
 {
     if (!std::filesystem::exists(filename)) {
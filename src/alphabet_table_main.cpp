@@ -0,0 +1,76 @@
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Headers
+#include <speller/alphabet.hpp>
+#include <speller/utility.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// C++ string literal, with octal escapes for non-ASCII characters
+std::string to_literal(std::string_view sw)
+{
+    std::string literal = "\"";
+    for (char ch : sw) {
+        const auto byte = static_cast<unsigned char>(ch);
+        if (byte < 0x20 || byte >= 0x7F || ch == '"' || ch == '\\') {
+            // octal escapes are limited to three digits, unlike hexadecimal ones
+            char escape[5];
+            std::snprintf(escape, sizeof(escape), "\\%03o", byte);
+            literal += escape;
+        } else {
+            literal += ch;
+        }
+    }
+    return literal + "\"";
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+try {
+    // Split command line arguments
+    const util::Arguments arguments = util::parse_arguments(argc, argv);
+    const std::vector<std::string>& positional = arguments.positional;
+    if (positional.empty()) {
+        std::cerr << "Usage: " << argv[0] << " <alphabet file> [table name]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // Validate alphabet resource file
+    const std::filesystem::path alphabet_path = positional[0];
+    static_cast<void>(speller::alphabet_from_file(alphabet_path.string()));
+    const std::string table_name = (positional.size() > 1) ? positional[1] : alphabet_path.stem().string();
+
+    // Print table declaration, to be placed in speller/builtin_alphabets.hpp
+    const std::vector<std::string> lines = util::file_to_vector(alphabet_path);
+    std::cout << "/// Generated from " << alphabet_path.filename().string() << " by speller_alphabet_table\n";
+    std::cout << "inline constexpr std::array<LetterCasePair, " << lines.size() << "> " << table_name << "_letters = { {\n";
+    for (const std::string& line : lines) {
+        const std::string::size_type pos = line.find('\t');
+        const std::string_view lowercase = std::string_view(line).substr(0, pos);
+        const std::string_view uppercase = std::string_view(line).substr(pos + 1);
+        const std::string lowercase_literal = to_literal(lowercase);
+        const std::string uppercase_literal = to_literal(uppercase);
+        std::cout << "    { " << lowercase_literal << ", " << uppercase_literal << " },";
+        // Show escaped letters as is
+        if (lowercase_literal.size() != lowercase.size() + 2 || uppercase_literal.size() != uppercase.size() + 2) {
+            std::cout << " // " << lowercase << ' ' << uppercase;
+        }
+        std::cout << "\n";
+    }
+    std::cout << "} };" << std::endl;
+} catch (const std::exception& e) {
+    // Print error and exit
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+}
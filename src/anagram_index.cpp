@@ -0,0 +1,157 @@
+#include <speller/anagram_index.hpp>
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <set>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Headers
+#include <speller/letter.hpp>
+#include <speller/word.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+AnagramIndex::WordInfo::WordInfo(const std::string& str, const std::string& locale_name)
+{
+    const Word word_lowercase = Word(str, locale_name).tolower();
+    lowercase_str = word_lowercase;
+    num_letters = word_lowercase.length();
+    for (size_t i = 0; i < word_lowercase.length(); i++) {
+        const size_t hash = std::hash<Letter>()(word_lowercase.at(i));
+        hashes.emplace(hash);
+    }
+}
+
+size_t AnagramIndex::WordInfo::length() const noexcept
+{
+    return num_letters;
+}
+
+const std::string& AnagramIndex::WordInfo::get_lowercase_str() const& noexcept
+{
+    return lowercase_str;
+}
+
+const std::multiset<size_t>& AnagramIndex::WordInfo::get_hashes() const& noexcept
+{
+    return hashes;
+}
+
+AnagramIndex::AnagramIndex(const EntryStore& store, const std::string& locale_name,
+    const AnagramIndex* previous, const EntryStore* previous_store)
+    : locale_name(locale_name)
+{
+    // entries of the previous index that can be reused as is
+    std::unordered_map<std::string_view, const WordInfo*> previous_infos;
+    if (previous && previous_store && previous->locale_name == locale_name) {
+        for (size_t id = 0; id < previous_store->size() && id < previous->infos.size(); id++) {
+            previous_infos.insert({ (*previous_store)[id], &previous->infos[id] });
+        }
+    }
+    // convert to lowercase and calculate hashes
+    infos.reserve(store.size());
+    for (size_t id = 0; id < store.size(); id++) {
+        const auto it = previous_infos.find(store[id]);
+        if (it != previous_infos.end()) {
+            infos.push_back(*it->second);
+        } else {
+            infos.emplace_back(std::string(store[id]), locale_name);
+        }
+    }
+}
+
+template <typename GetId>
+std::vector<AnagramMatch> AnagramIndex::find_in(const std::string& query, size_t num_candidates, GetId get_id, QueryBudget& budget, ResultPage& page) const
+{
+    // analyze query
+    const WordInfo search_info(query, locale_name);
+    const std::multiset<size_t>& search_hashes = search_info.get_hashes();
+    constexpr char joker_letter = '?';
+    const size_t num_jokers = std::count(query.begin(), query.end(), joker_letter);
+
+    std::vector<AnagramMatch> results;
+    for (size_t index = 0; index < num_candidates; index++) {
+        const size_t id = get_id(index);
+        const WordInfo& info = infos[id];
+
+        // stop when the page is complete or the budget is exhausted
+        if (page.is_complete()) {
+            page.stop();
+            break;
+        }
+        if (!budget.visit_candidates()) {
+            break;
+        }
+
+        // lengths must match
+        if (info.length() != search_info.length()) {
+            continue;
+        }
+
+        // calculate number of common letters
+        const std::multiset<size_t>& info_hashes = info.get_hashes();
+        std::multiset<size_t> common_hashes;
+        std::set_intersection(search_hashes.begin(), search_hashes.end(),
+            info_hashes.begin(), info_hashes.end(),
+            std::inserter(common_hashes, common_hashes.begin()));
+
+        // check whether all letters match
+        if (common_hashes.size() + num_jokers != search_info.length()) {
+            continue;
+        }
+
+        // skip matches outside of the page
+        if (!page.take()) {
+            continue;
+        }
+        if (!budget.add_result()) {
+            break;
+        }
+
+        // find joker letters, taking their text from the entry, since they need not be in the alphabet
+        std::multiset<size_t> joker_hashes;
+        std::set_difference(info_hashes.begin(), info_hashes.end(),
+            common_hashes.begin(), common_hashes.end(),
+            std::inserter(joker_hashes, joker_hashes.begin()));
+        AnagramMatch result;
+        result.entry_id = id;
+        const Word word(info.get_lowercase_str(), locale_name);
+        for (size_t i = 0; i < word.length() && !joker_hashes.empty(); i++) {
+            const auto it = joker_hashes.find(std::hash<Letter>()(word.at(i)));
+            if (it != joker_hashes.end()) {
+                joker_hashes.erase(it);
+                result.joker_letters.push_back(word.at(i).string());
+            }
+        }
+        results.emplace_back(std::move(result));
+    }
+    return results;
+}
+
+std::vector<AnagramMatch> AnagramIndex::find(const std::string& query, QueryBudget& budget, ResultPage& page) const
+{
+    return find_in(query, infos.size(), [](size_t index) { return index; }, budget, page);
+}
+
+std::vector<AnagramMatch> AnagramIndex::find(const std::string& query, const std::vector<size_t>& candidate_ids, QueryBudget& budget, ResultPage& page) const
+{
+    return find_in(query, candidate_ids.size(), [&candidate_ids](size_t index) { return candidate_ids[index]; }, budget, page);
+}
+
+const std::string& AnagramIndex::get_lowercase_str(size_t entry_id) const&
+{
+    return infos.at(entry_id).get_lowercase_str();
+}
+
+const std::string& AnagramIndex::get_locale_name() const& noexcept
+{
+    return locale_name;
+}
+
+} // namespace speller
@@ -0,0 +1,289 @@
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// System Headers
+#ifdef __linux__
+#include <unistd.h>
+#endif
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Headers
+#include <speller/alphabet.hpp>
+#include <speller/dictionary.hpp>
+#include <speller/dictionary_generator.hpp>
+#include <speller/entry_store.hpp>
+#include <speller/letter_matrix.hpp>
+#include <speller/locale.hpp>
+#include <speller/query_budget.hpp>
+#include <speller/result_page.hpp>
+#include <speller/search.hpp>
+#include <speller/utility.hpp>
+#include <speller/word.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/// Resident set size of the process in bytes, zero if unknown
+size_t get_resident_bytes()
+{
+#ifdef __linux__
+    std::ifstream ifs("/proc/self/statm");
+    size_t total_pages = 0;
+    size_t resident_pages = 0;
+    if (ifs >> total_pages >> resident_pages) {
+        return resident_pages * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    }
+#endif
+    return 0;
+}
+
+/// Growth of the resident set size since it was @a baseline_bytes
+size_t get_resident_bytes_since(size_t baseline_bytes)
+{
+    const size_t resident_bytes = get_resident_bytes();
+    return (resident_bytes > baseline_bytes) ? resident_bytes - baseline_bytes : 0;
+}
+
+double get_elapsed_ms(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+std::vector<size_t> parse_sizes(const std::string& str)
+{
+    std::vector<size_t> sizes;
+    std::istringstream iss(str);
+    for (std::string token; std::getline(iss, token, ',');) {
+        sizes.push_back(std::stoul(token));
+    }
+    return sizes;
+}
+
+/// Letters of the first word of an entry
+std::vector<std::string> get_first_word_letters(std::string_view entry, const std::string& locale_name)
+{
+    const speller::Word word(std::string(entry), locale_name);
+    std::vector<std::string> letters;
+    for (size_t i = 0; i < word.length() && word[i].string_view() != " "; i++) {
+        letters.push_back(word[i].string());
+    }
+    return letters;
+}
+
+std::string join(const std::vector<std::string>& letters, size_t begin, size_t end)
+{
+    std::string str;
+    for (size_t i = begin; i < end && i < letters.size(); i++) {
+        str += letters[i];
+    }
+    return str;
+}
+
+/// Measurements of a mode for a dictionary size
+struct Measurement {
+    double load_ms;
+    /// Growth of the resident set size while loading, excluding the generated content and earlier modes
+    size_t resident_bytes;
+    std::vector<double> latencies_ms;
+};
+
+void print_measurement(size_t num_entries, const char* mode, Measurement& measurement)
+{
+    std::vector<double>& latencies = measurement.latencies_ms;
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&latencies](size_t percent) {
+        return latencies.empty() ? 0.0 : latencies[(latencies.size() - 1) * percent / 100];
+    };
+    std::cout << num_entries << '\t' << mode
+              << '\t' << measurement.load_ms
+              << '\t' << measurement.resident_bytes / (1 << 20)
+              << '\t' << percentile(50)
+              << '\t' << percentile(95)
+              << '\t' << percentile(100) << std::endl;
+}
+
+/// Queries of a mode, drawn from the letters of the first word of an entry
+struct Mode {
+    const char* name;
+
+    /// Build the same indexes as the executable of the mode
+    std::function<void(const speller::Dictionary&)> build_indexes;
+
+    /// Query of given index, drawn from the lowercase letters of an entry
+    std::function<std::string(std::vector<std::string> letters, size_t query_index)> make_query;
+
+    std::function<void(const speller::Dictionary&, const std::string& query, speller::QueryBudget&, speller::ResultPage&)> run_query;
+};
+
+/// Load a dictionary of @\a content for @\a mode, then answer queries drawn from its entries
+void measure_mode(const Mode& mode, size_t num_entries, const std::string& content, const std::string& locale_name, std::uint64_t seed, size_t num_queries)
+{
+    // return the memory of earlier modes to the system, so that loading cannot reuse it without growing
+#ifdef __GLIBC__
+    malloc_trim(0);
+#endif
+    Measurement measurement;
+    const size_t baseline_bytes = get_resident_bytes();
+    const Clock::time_point start = Clock::now();
+    const speller::Dictionary dictionary(speller::EntryStore(content), locale_name);
+    mode.build_indexes(dictionary);
+    measurement.load_ms = get_elapsed_ms(start);
+    measurement.resident_bytes = get_resident_bytes_since(baseline_bytes);
+
+    // draw queries from existing entries, so that they have matches
+    std::mt19937_64 rng(seed);
+    for (size_t i = 0; i < num_queries; i++) {
+        const std::string entry = speller::to_lowercase(dictionary[rng() % dictionary.size()], locale_name);
+        const std::string query = mode.make_query(get_first_word_letters(entry, locale_name), i);
+        const Clock::time_point query_start = Clock::now();
+        speller::QueryBudget budget;
+        speller::ResultPage page;
+        mode.run_query(dictionary, query, budget, page);
+        measurement.latencies_ms.push_back(get_elapsed_ms(query_start));
+    }
+    print_measurement(num_entries, mode.name, measurement);
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+try {
+    // Split command line arguments
+    const util::Arguments arguments = util::parse_arguments(argc, argv);
+    const std::vector<std::string>& positional = arguments.positional;
+
+    // Obtain benchmark parameters
+    const std::vector<size_t> sizes = parse_sizes(util::get_option(arguments, "sizes", std::string("1000000,10000000,100000000")));
+    const std::uint64_t seed = util::get_option(arguments, "seed", std::uint64_t(1));
+    const size_t num_queries = util::get_option(arguments, "queries", size_t(20));
+
+    // Obtain alphabet resource file, if specified
+    std::string locale_name = speller::Locale::default_locale_name;
+    if (positional.size() > 0) {
+        const std::filesystem::path alphabet_path = positional[0];
+        speller::Alphabet alphabet = speller::alphabet_from_file(alphabet_path.string());
+        locale_name = speller::Locale::add_unique_locale(alphabet_path.stem().string(), std::move(alphabet));
+    }
+
+    // Obtain distributions from a sample dictionary, if specified
+    speller::DictionaryProfile profile = speller::default_dictionary_profile(locale_name);
+    if (positional.size() > 1) {
+        const speller::EntryStore sample = speller::EntryStore::from_file(positional[1]);
+        profile = speller::dictionary_profile_from_entries(sample.get_entries(), locale_name);
+    }
+
+    // Describe the queries of each mode
+    const std::vector<Mode> modes = {
+        { "regex",
+            [](const speller::Dictionary&) {},
+            [](std::vector<std::string> letters, size_t) { return join(letters, 0, 3); },
+            [](const speller::Dictionary& dictionary, const std::string& query, speller::QueryBudget& budget, speller::ResultPage& page) {
+                dictionary.search_regex(speller::compile_regex(query), budget, page);
+            } },
+        { "search",
+            [](const speller::Dictionary& dictionary) {
+                dictionary.get_key_index();
+                if (dictionary.uses_suffix_index()) {
+                    dictionary.get_suffix_index();
+                }
+                dictionary.get_statistics();
+            },
+            [](std::vector<std::string> letters, size_t query_index) {
+                // rotate between prefix, suffix and single letter wildcards
+                switch (query_index % 3) {
+                case 0:
+                    return join(letters, 0, 2) + "*";
+                case 1:
+                    return "*" + join(letters, std::max<size_t>(letters.size(), 2) - 2, letters.size());
+                default:
+                    return "?" + join(letters, 1, letters.size());
+                }
+            },
+            [](const speller::Dictionary& dictionary, const std::string& query, speller::QueryBudget& budget, speller::ResultPage& page) {
+                dictionary.match_wildcard(query, budget, page);
+            } },
+        { "search_any",
+            [](const speller::Dictionary& dictionary) {
+                dictionary.get_anagram_index();
+                dictionary.get_statistics();
+            },
+            [seed](std::vector<std::string> letters, size_t query_index) {
+                // shuffle letters and hide one of them
+                std::shuffle(letters.begin(), letters.end(), std::mt19937_64(seed + query_index));
+                letters.front() = "?";
+                return join(letters, 0, letters.size());
+            },
+            [](const speller::Dictionary& dictionary, const std::string& query, speller::QueryBudget& budget, speller::ResultPage& page) {
+                dictionary.find_anagrams(query, budget, page);
+            } },
+        { "letter_set",
+            [](const speller::Dictionary& dictionary) {
+                dictionary.get_letter_matrix();
+                dictionary.get_statistics();
+            },
+            [](std::vector<std::string> letters, size_t) {
+                // rotate between a letter, a set of the letter and its neighbor, and any letter for each position
+                std::string query;
+                for (size_t i = 0; i < letters.size(); i++) {
+                    switch (i % 3) {
+                    case 0:
+                        query += letters[i];
+                        break;
+                    case 1:
+                        query += "[" + letters[i] + letters[i - 1] + "]";
+                        break;
+                    default:
+                        query += "?";
+                        break;
+                    }
+                }
+                return query;
+            },
+            [&locale_name](const speller::Dictionary& dictionary, const std::string& query, speller::QueryBudget& budget, speller::ResultPage& page) {
+                dictionary.find_letter_set(speller::parse_letter_set_query(query, locale_name), budget, page);
+            } },
+    };
+
+    // Print columns of the report
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "entries\tmode\tload_ms\tload_rss_mib\tp50_ms\tp95_ms\tmax_ms" << std::endl;
+
+    for (size_t num_entries : sizes) {
+        // Generate the same entries for every mode
+        std::string content;
+        speller::DictionaryGenerator generator(profile, locale_name, seed);
+        for (size_t i = 0; i < num_entries; i++) {
+            generator.append_next(content);
+            content += '\n';
+        }
+
+        // Answer the queries of each mode from a dictionary of its own
+        for (const Mode& mode : modes) {
+            measure_mode(mode, num_entries, content, locale_name, seed, num_queries);
+        }
+    }
+} catch (const std::exception& e) {
+    // Print error and exit
+    std::cout << "Exception: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+}
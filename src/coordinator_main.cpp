@@ -0,0 +1,350 @@
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <algorithm>
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <iostream>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// System Headers
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Headers
+#include <speller/alphabet.hpp>
+#include <speller/locale.hpp>
+#include <speller/message_channel.hpp>
+#include <speller/query_budget.hpp>
+#include <speller/result_page.hpp>
+#include <speller/shard.hpp>
+#include <speller/utility.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// What every worker needs to load its shard
+struct ShardConfig {
+    std::filesystem::path speller_path;
+    speller::ShardLayout layout;
+    speller::ShardMode mode;
+};
+
+/// Load a shard and answer requests until the coordinator closes the channel
+[[noreturn]] void run_worker(speller::MessageChannel channel, const ShardConfig& config, size_t shard_index)
+{
+    int exit_code = EXIT_SUCCESS;
+    try {
+        const speller::Shard shard(config.speller_path, config.layout, shard_index, config.mode);
+        // Report readiness with an empty message
+        if (channel.send("")) {
+            std::string message;
+            while (channel.receive(message)) {
+                const speller::ShardResponse response = shard.answer(speller::decode_shard_request(message));
+                if (!channel.send(speller::encode_shard_response(response))) {
+                    break;
+                }
+            }
+        }
+    } catch (const std::exception& e) {
+        // Report the failure instead of readiness
+        channel.send(e.what());
+        exit_code = EXIT_FAILURE;
+    }
+    // Skip destructors of objects shared with the coordinator
+    _exit(exit_code);
+}
+
+/// Worker processes, one for each shard
+class Coordinator {
+public:
+    /// Start every worker and wait until they are loaded
+    /// @warning Throws if a worker cannot be started or fails to load.
+    explicit Coordinator(ShardConfig config_value)
+        : config(std::move(config_value))
+        , workers(config.layout.num_shards)
+    {
+        // Load shards in parallel
+        for (size_t shard_index = 0; shard_index < workers.size(); shard_index++) {
+            spawn_worker(shard_index);
+        }
+        for (size_t shard_index = 0; shard_index < workers.size(); shard_index++) {
+            wait_until_ready(shard_index);
+        }
+    }
+
+    Coordinator(const Coordinator&) = delete;
+    Coordinator& operator=(const Coordinator&) = delete;
+
+    ~Coordinator()
+    {
+        // Workers exit when their channel is closed
+        for (Worker& worker : workers) {
+            worker.channel = speller::MessageChannel(-1);
+        }
+        for (Worker& worker : workers) {
+            if (worker.pid > 0) {
+                waitpid(worker.pid, nullptr, 0);
+            }
+        }
+    }
+
+    /**
+    Send @a request to the workers of the target shards and collect their responses
+
+    A worker that terminates or does not respond in time is restarted, and the request is retried once.
+
+    @param target Index of the only shard to ask, or speller::ShardLayout::all_shards
+    @param response_timeout Maximum duration to wait for a response, zero for no limit
+    */
+    std::vector<speller::ShardResponse> query(const speller::ShardRequest& request, size_t target, std::chrono::milliseconds response_timeout)
+    {
+        std::vector<size_t> shard_indices;
+        for (size_t shard_index = 0; shard_index < workers.size(); shard_index++) {
+            if (target == speller::ShardLayout::all_shards || target == shard_index) {
+                shard_indices.push_back(shard_index);
+            }
+        }
+        // Workers answer in parallel
+        const std::string message = speller::encode_shard_request(request);
+        std::vector<bool> sent;
+        for (size_t shard_index : shard_indices) {
+            sent.push_back(workers[shard_index].pid > 0 && workers[shard_index].channel.send(message));
+        }
+        std::vector<speller::ShardResponse> responses;
+        for (size_t i = 0; i < shard_indices.size(); i++) {
+            const size_t shard_index = shard_indices[i];
+            speller::MessageChannel& channel = workers[shard_index].channel;
+            std::string reply;
+            std::string error;
+            bool answered = sent[i] && channel.receive(reply, response_timeout);
+            if (!answered) {
+                answered = restart_worker(shard_index, error) && channel.send(message) && channel.receive(reply, response_timeout);
+            }
+            if (answered) {
+                responses.push_back(speller::decode_shard_response(reply));
+                continue;
+            }
+            // Leave a ready worker for the next query
+            if (error.empty()) {
+                restart_worker(shard_index, error);
+            }
+            speller::ShardResponse failed;
+            failed.error = "Worker of shard " + std::to_string(shard_index) + " failed" + (error.empty() ? "" : ": " + error);
+            failed.is_num_matches_exact = false;
+            responses.push_back(std::move(failed));
+        }
+        return responses;
+    }
+
+private:
+    struct Worker {
+        pid_t pid = -1;
+        speller::MessageChannel channel { -1 };
+    };
+
+    void spawn_worker(size_t shard_index)
+    {
+        int fds[2];
+        if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0) {
+            throw std::system_error(errno, std::generic_category(), "Cannot create socket pair");
+        }
+        // Buffered output would be written by both processes otherwise
+        std::cout.flush();
+        const pid_t pid = fork();
+        if (pid < 0) {
+            close(fds[0]);
+            close(fds[1]);
+            throw std::system_error(errno, std::generic_category(), "Cannot start worker");
+        }
+        if (pid == 0) {
+            close(fds[0]);
+            for (Worker& worker : workers) {
+                worker.channel = speller::MessageChannel(-1);
+            }
+            run_worker(speller::MessageChannel(fds[1]), config, shard_index);
+        }
+        close(fds[1]);
+        workers[shard_index].pid = pid;
+        workers[shard_index].channel = speller::MessageChannel(fds[0]);
+    }
+
+    void wait_until_ready(size_t shard_index)
+    {
+        std::string message;
+        if (!workers[shard_index].channel.receive(message)) {
+            throw std::runtime_error("Worker of shard " + std::to_string(shard_index) + " terminated while loading");
+        }
+        if (!message.empty()) {
+            throw std::runtime_error(message);
+        }
+    }
+
+    void stop_worker(size_t shard_index) noexcept
+    {
+        Worker& worker = workers[shard_index];
+        worker.channel = speller::MessageChannel(-1);
+        if (worker.pid > 0) {
+            kill(worker.pid, SIGKILL);
+            waitpid(worker.pid, nullptr, 0);
+            worker.pid = -1;
+        }
+    }
+
+    /// @return false if the worker cannot be restarted, with the reason in @a error
+    bool restart_worker(size_t shard_index, std::string& error)
+    {
+        stop_worker(shard_index);
+        try {
+            spawn_worker(shard_index);
+            wait_until_ready(shard_index);
+            return true;
+        } catch (const std::exception& e) {
+            stop_worker(shard_index);
+            error = e.what();
+            return false;
+        }
+    }
+
+    ShardConfig config;
+    std::vector<Worker> workers;
+};
+
+} // namespace
+
+int main(int argc, char** argv)
+try {
+    // Split command line arguments
+    const util::Arguments arguments = util::parse_arguments(argc, argv);
+    const std::vector<std::string>& positional = arguments.positional;
+
+    // Obtain speller resource file path
+    const std::filesystem::path speller_path = (positional.size() > 0) ? positional[0] : "tr.txt";
+    std::cout << "Speller filename: " << speller_path.string() << "\n";
+
+    // Obtain alphabet resource file, if specified
+    std::string locale_name = speller::Locale::default_locale_name;
+    if (positional.size() > 1) {
+        // Print configuration
+        const std::string alphabet_filename = positional[1];
+        locale_name = (positional.size() > 2) ? positional[2] : speller_path.stem().string();
+        std::cout << "Alphabet filename: " << alphabet_filename << "\n";
+        std::cout << "Locale: " << locale_name << "\n";
+        // Add locale before starting workers, so that they inherit it
+        speller::Alphabet alphabet = speller::alphabet_from_file(alphabet_filename);
+        locale_name = speller::Locale::add_unique_locale(locale_name, std::move(alphabet));
+    }
+
+    // Obtain sharding configuration
+    ShardConfig config;
+    config.speller_path = speller_path;
+    config.layout.locale_name = locale_name;
+    const std::string mode_name = util::get_option(arguments, "mode", std::string("regex"));
+    config.mode = speller::shard_mode_from_string(mode_name);
+    const std::string strategy_name = util::get_option(arguments, "shard-by", std::string("length"));
+    config.layout.strategy = speller::shard_strategy_from_string(strategy_name);
+    config.layout.num_shards = util::get_option(arguments, "shards", size_t(2));
+    if (config.layout.num_shards == 0) {
+        throw std::invalid_argument("Number of shards must be positive");
+    }
+    std::cout << "Mode: " << mode_name << "\n";
+    std::cout << "Shards: " << config.layout.num_shards << " by " << strategy_name << std::endl;
+    std::cout << std::endl;
+
+    // Obtain query limits
+    speller::QueryLimits limits;
+    limits.timeout = std::chrono::milliseconds(util::get_option(arguments, "timeout-ms", limits.timeout.count()));
+    limits.max_candidates = util::get_option(arguments, "max-candidates", limits.max_candidates);
+    limits.max_results = util::get_option(arguments, "max-results", limits.max_results);
+    // Allow workers to report a timeout before they are considered unresponsive
+    const std::chrono::milliseconds response_timeout = (limits.timeout.count() > 0) ? limits.timeout + std::chrono::seconds(1) : limits.timeout;
+
+    // Obtain result page
+    const size_t offset = util::get_option(arguments, "offset", size_t(0));
+    const size_t limit = util::get_option(arguments, "limit", speller::ResultPage::unlimited);
+    const bool count_only = util::has_option(arguments, "count-only");
+
+    // Start workers, detecting terminated ones by failed writes
+    std::signal(SIGPIPE, SIG_IGN);
+    Coordinator coordinator(config);
+
+    // Configure standard input
+    util::enable_exceptions(std::cin);
+    std::cin.tie(&std::cout);
+
+    // Configure standard output for matches
+    util::OutputBuffer output;
+
+    // Run in an infinite loop
+    while (true) {
+        // Obtain search string
+        std::cout << "Search: ";
+        std::string search_str;
+        std::cin >> search_str;
+
+        // Each shard returns the matches up to the end of the page
+        speller::ShardRequest request;
+        request.query = search_str;
+        request.max_matches = (limit > speller::ResultPage::unlimited - offset) ? speller::ResultPage::unlimited : offset + limit;
+        request.count_only = count_only;
+        request.limits = limits;
+
+        // Ask only the shard that can match, if any
+        std::vector<speller::ShardResponse> responses;
+        try {
+            const size_t target = config.layout.get_query_shard_index(config.mode, search_str);
+            responses = coordinator.query(request, target, response_timeout);
+        } catch (const std::exception& e) {
+            speller::ShardResponse failed;
+            failed.error = e.what();
+            responses.push_back(std::move(failed));
+        }
+
+        // Merge matches in dictionary order
+        size_t num_matches = 0;
+        bool is_num_matches_exact = true;
+        std::string truncation_reason;
+        std::set<std::string> errors;
+        std::vector<std::pair<size_t, std::string>> matches;
+        for (speller::ShardResponse& response : responses) {
+            num_matches += response.num_matches;
+            is_num_matches_exact = is_num_matches_exact && response.is_num_matches_exact && response.error.empty();
+            if (truncation_reason.empty()) {
+                truncation_reason = response.truncation_reason;
+            }
+            if (!response.error.empty()) {
+                errors.insert(response.error);
+            }
+            std::move(response.matches.begin(), response.matches.end(), std::back_inserter(matches));
+        }
+        std::sort(matches.begin(), matches.end());
+
+        // Print matches in the page
+        const char* const lower_bound_str = is_num_matches_exact ? "" : "at least ";
+        output << "A total of " << lower_bound_str << num_matches << " matches found.\n";
+        if (!truncation_reason.empty()) {
+            output << "Search truncated: " << truncation_reason << ".\n";
+        }
+        for (const std::string& error : errors) {
+            output << "Query failed: " << error << "\n";
+        }
+        for (size_t i = offset; i < matches.size() && i - offset < limit; i++) {
+            output << matches[i].second << '\n';
+        }
+        output << '\n';
+        output.flush();
+    }
+} catch (const std::exception& e) {
+    // Print error and exit
+    std::cout << "Exception: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+}
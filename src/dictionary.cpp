@@ -0,0 +1,400 @@
+#include <speller/dictionary.hpp>
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <regex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Headers
+#include <speller/alphabet.hpp>
+#include <speller/locale.hpp>
+#include <speller/search.hpp>
+#include <speller/word.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+// index that is built once, by the first thread that accesses it
+template <typename T>
+class LazyIndex {
+public:
+    template <typename Builder>
+    const T& get(Builder builder)
+    {
+        if (const T* built = index.load(std::memory_order_acquire)) {
+            return *built;
+        }
+        const std::lock_guard<std::mutex> lock(mutex);
+        if (!storage) {
+            storage.emplace(builder());
+            index.store(&*storage, std::memory_order_release);
+        }
+        return *storage;
+    }
+
+    // nullptr if not built yet
+    const T* get_if_built() const noexcept
+    {
+        return index.load(std::memory_order_acquire);
+    }
+
+private:
+    std::mutex mutex;
+    std::optional<T> storage;
+    std::atomic<const T*> index = nullptr;
+};
+
+struct Dictionary::Indexes {
+    LazyIndex<EntryStatistics> statistics;
+    LazyIndex<SortedKeyIndex> key_index;
+    LazyIndex<SortedKeyIndex> suffix_index;
+    LazyIndex<AnagramIndex> anagram_index;
+    LazyIndex<LetterMatrix> letter_matrix;
+    LazyIndex<LetterTrie> letter_trie;
+    LazyIndex<PhraseIndex> phrase_index;
+};
+
+Dictionary::Dictionary(EntryStore entries_value, std::string locale_name_value, const Dictionary* previous)
+    : entries(std::move(entries_value))
+    , locale_name(std::move(locale_name_value))
+    , indexes(std::make_unique<Indexes>())
+{
+    // given locale must exist
+    const Locale locale(locale_name);
+
+    // keep the same indexes warm as the previous version
+    if (!previous || !previous->indexes) {
+        return;
+    }
+    const Indexes& previous_indexes = *previous->indexes;
+    if (previous_indexes.statistics.get_if_built()) {
+        get_statistics();
+    }
+    if (previous_indexes.key_index.get_if_built()) {
+        get_key_index();
+    }
+    if (previous_indexes.suffix_index.get_if_built() && uses_suffix_index()) {
+        get_suffix_index();
+    }
+    if (const AnagramIndex* previous_anagram_index = previous_indexes.anagram_index.get_if_built()) {
+        indexes->anagram_index.get([&]() { return AnagramIndex(entries, locale_name, previous_anagram_index, &previous->entries); });
+    }
+    if (previous_indexes.letter_matrix.get_if_built()) {
+        get_letter_matrix();
+    }
+    if (previous_indexes.letter_trie.get_if_built()) {
+        get_letter_trie();
+    }
+    if (previous_indexes.phrase_index.get_if_built()) {
+        get_phrase_index();
+    }
+}
+
+Dictionary Dictionary::from_file(const std::filesystem::path& filename, std::string locale_name)
+{
+    return Dictionary(EntryStore::from_file(filename), std::move(locale_name));
+}
+
+Dictionary::Dictionary(Dictionary&&) noexcept = default;
+
+Dictionary& Dictionary::operator=(Dictionary&&) noexcept = default;
+
+Dictionary::~Dictionary() = default;
+
+size_t Dictionary::size() const noexcept
+{
+    return entries.size();
+}
+
+std::string_view Dictionary::operator[](size_t id) const& noexcept
+{
+    return entries[id];
+}
+
+const EntryStore& Dictionary::get_entries() const& noexcept
+{
+    return entries;
+}
+
+const std::string& Dictionary::get_locale_name() const& noexcept
+{
+    return locale_name;
+}
+
+std::vector<EntryHandle> Dictionary::search_regex(const std::regex& rgx, QueryBudget& budget, ResultPage& page) const
+{
+    return speller::search_regex(entries, rgx, budget, page);
+}
+
+std::vector<EntryHandle> Dictionary::match_wildcard(const std::string& pattern, QueryBudget& budget, ResultPage& page) const
+{
+    const QueryPlan plan = plan_wildcard(pattern);
+    const AccessPath first_access_path = plan.access_paths.front();
+    std::vector<EntryHandle> results;
+
+    // account a match in dictionary order, returning whether to continue
+    auto take_match = [&](size_t id) {
+        if (!page.take()) {
+            return true;
+        }
+        if (!budget.add_result()) {
+            return false;
+        }
+        results.push_back(entries.get_handle(id));
+        return true;
+    };
+
+    if (first_access_path == AccessPath::exact_key) {
+        if (!budget.visit_candidates()) {
+            return results;
+        }
+        for (size_t id : get_key_index().find(plan.shape.anchored_prefix)) {
+            if (page.is_complete()) {
+                page.stop();
+                break;
+            }
+            if (!take_match(id)) {
+                break;
+            }
+        }
+    } else if (first_access_path == AccessPath::full_scan || plan.access_paths == std::vector<AccessPath> { AccessPath::key_prefix }) {
+        // test each distinct key that starts with the anchored prefix once, then account
+        // every match, including those found before the budget ran out, since keys are not in dictionary order
+        for (size_t id : get_key_index().match(wildcard_to_regex(pattern, locale_name), plan.shape.anchored_prefix, budget)) {
+            if (!take_match(id)) {
+                break;
+            }
+        }
+    } else {
+        // test each candidate on its own, in dictionary order
+        const std::regex rgx = wildcard_to_regex(pattern, locale_name);
+        for (size_t id : find_candidates(plan)) {
+            if (page.is_complete()) {
+                page.stop();
+                break;
+            }
+            if (!budget.visit_expensive_candidate()) {
+                break;
+            }
+            const std::string key = to_lowercase(entries[id], locale_name);
+            if (!std::regex_match(key, rgx)) {
+                continue;
+            }
+            if (!take_match(id)) {
+                break;
+            }
+        }
+    }
+    return results;
+}
+
+std::vector<AnagramMatch> Dictionary::find_anagrams(const std::string& query, QueryBudget& budget, ResultPage& page) const
+{
+    const QueryPlan plan = plan_anagrams(query);
+    if (plan.access_paths.front() == AccessPath::full_scan) {
+        return get_anagram_index().find(query, budget, page);
+    }
+    return get_anagram_index().find(query, find_candidates(plan), budget, page);
+}
+
+std::vector<size_t> Dictionary::find_letter_set(const LetterSetQuery& query, QueryBudget& budget, ResultPage& page) const
+{
+    const QueryPlan plan = plan_letter_set(query);
+    if (plan.access_paths.front() == AccessPath::letter_matrix) {
+        return get_letter_matrix().find(query, budget, page);
+    }
+
+    // test each candidate on its own, in the same order as the letter matrix
+    std::vector<size_t> candidate_ids;
+    if (plan.access_paths.front() == AccessPath::full_scan) {
+        candidate_ids.resize(entries.size());
+        std::iota(candidate_ids.begin(), candidate_ids.end(), 0);
+    } else {
+        candidate_ids = find_candidates(plan);
+    }
+    std::vector<size_t> results;
+    for (size_t id : candidate_ids) {
+        if (page.is_complete()) {
+            page.stop();
+            break;
+        }
+        if (!budget.visit_candidates()) {
+            break;
+        }
+        if (!matches_letter_set(query, entries[id], locale_name)) {
+            continue;
+        }
+        if (!page.take()) {
+            continue;
+        }
+        if (!budget.add_result()) {
+            break;
+        }
+        results.push_back(id);
+    }
+    return results;
+}
+
+std::vector<RackMatch> Dictionary::find_formable(const RackQuery& query, const std::vector<size_t>& letter_scores, QueryBudget& budget, ResultPage& page) const
+{
+    return get_letter_trie().find_formable(query, letter_scores, budget, page);
+}
+
+std::vector<size_t> Dictionary::find_phrases(const PhraseQuery& query, QueryBudget& budget, ResultPage& page) const
+{
+    return get_phrase_index().find(query, budget, page);
+}
+
+std::vector<std::vector<size_t>> Dictionary::find_substrings(const std::vector<std::string>& patterns, QueryBudget& budget) const
+{
+    return SubstringAutomaton(patterns, locale_name).find_all(entries, budget);
+}
+
+std::string Dictionary::format_anagram_match(const AnagramMatch& match, bool has_jokers) const
+{
+    std::string line = get_anagram_index().get_lowercase_str(match.entry_id);
+    if (has_jokers) {
+        line += '\t';
+        for (const std::string& letter : match.joker_letters) {
+            line += letter;
+        }
+    }
+    return line;
+}
+
+std::string Dictionary::format_rack_match(const RackMatch& match, bool has_scores, bool has_jokers) const
+{
+    std::string line(entries[match.word_index]);
+    if (has_scores) {
+        line += '\t';
+        line += std::to_string(match.score);
+    }
+    if (has_jokers) {
+        const Alphabet& alphabet = Locale(locale_name).get_alphabet();
+        line += '\t';
+        for (LetterId id : match.joker_letter_ids) {
+            line += alphabet.get_lowercase_letter(id).string_view();
+        }
+    }
+    return line;
+}
+
+QueryPlan Dictionary::plan_wildcard(const std::string& pattern) const
+{
+    QueryShape shape = shape_from_wildcard(pattern, locale_name);
+    PlanningIndexes planning_indexes = get_built_indexes();
+    planning_indexes.key_index = &get_key_index();
+    if (!shape.anchored_suffix.empty() && uses_suffix_index()) {
+        planning_indexes.suffix_index = &get_suffix_index();
+    }
+    return plan_query(std::move(shape), planning_indexes, locale_name);
+}
+
+QueryPlan Dictionary::plan_anagrams(const std::string& query) const
+{
+    return plan_query(shape_from_anagram(query, locale_name), get_built_indexes(), locale_name);
+}
+
+QueryPlan Dictionary::plan_letter_set(const LetterSetQuery& query) const
+{
+    PlanningIndexes planning_indexes = get_built_indexes();
+    planning_indexes.letter_matrix = &get_letter_matrix();
+    return plan_query(shape_from_letter_set(query, locale_name), planning_indexes, locale_name);
+}
+
+PlanningIndexes Dictionary::get_built_indexes() const
+{
+    PlanningIndexes planning_indexes;
+    planning_indexes.num_entries = entries.size();
+    planning_indexes.statistics = indexes->statistics.get_if_built();
+    planning_indexes.key_index = indexes->key_index.get_if_built();
+    if (uses_suffix_index()) {
+        planning_indexes.suffix_index = indexes->suffix_index.get_if_built();
+    }
+    return planning_indexes;
+}
+
+std::vector<size_t> Dictionary::find_candidates(const QueryPlan& plan) const
+{
+    const QueryShape& shape = plan.shape;
+    std::vector<size_t> candidate_ids;
+    for (size_t i = 0; i < plan.access_paths.size(); i++) {
+        std::vector<size_t> ids;
+        switch (plan.access_paths[i]) {
+        case AccessPath::key_prefix:
+            ids = get_key_index().find_prefix(shape.anchored_prefix);
+            break;
+        case AccessPath::key_suffix:
+            ids = get_suffix_index().find_prefix(reverse_letters(shape.anchored_suffix, locale_name));
+            break;
+        case AccessPath::length_mask:
+            ids = get_statistics().find(shape.min_length, shape.max_length, shape.get_required_letters_mask());
+            break;
+        default:
+            throw std::logic_error("Access path does not produce candidates");
+        }
+        // all access paths produce identifiers in ascending order
+        if (i == 0) {
+            candidate_ids = std::move(ids);
+        } else {
+            std::vector<size_t> intersection;
+            std::set_intersection(candidate_ids.begin(), candidate_ids.end(), ids.begin(), ids.end(), std::back_inserter(intersection));
+            candidate_ids = std::move(intersection);
+        }
+    }
+    return candidate_ids;
+}
+
+const EntryStatistics& Dictionary::get_statistics() const&
+{
+    return indexes->statistics.get([this]() { return EntryStatistics(entries, locale_name); });
+}
+
+const SortedKeyIndex& Dictionary::get_key_index() const&
+{
+    return indexes->key_index.get([this]() { return SortedKeyIndex(entries, locale_name); });
+}
+
+const SortedKeyIndex& Dictionary::get_suffix_index() const&
+{
+    return indexes->suffix_index.get([this]() { return SortedKeyIndex(entries, locale_name, SortedKeyIndex::KeyDirection::reversed); });
+}
+
+bool Dictionary::uses_suffix_index() const
+{
+    // letters must be code points to be reversed independently of their neighbors
+    return Locale(locale_name).get_alphabet().get_encoding() != Alphabet::Encoding::generic;
+}
+
+const AnagramIndex& Dictionary::get_anagram_index() const&
+{
+    return indexes->anagram_index.get([this]() { return AnagramIndex(entries, locale_name); });
+}
+
+const LetterMatrix& Dictionary::get_letter_matrix() const&
+{
+    return indexes->letter_matrix.get([this]() { return LetterMatrix(entries.get_entries(), locale_name); });
+}
+
+const LetterTrie& Dictionary::get_letter_trie() const&
+{
+    return indexes->letter_trie.get([this]() { return LetterTrie(entries.get_entries(), locale_name); });
+}
+
+const PhraseIndex& Dictionary::get_phrase_index() const&
+{
+    return indexes->phrase_index.get([this]() { return PhraseIndex(entries, locale_name); });
+}
+
+} // namespace speller
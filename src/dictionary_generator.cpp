@@ -0,0 +1,161 @@
+#include <speller/dictionary_generator.hpp>
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Headers
+#include <speller/alphabet.hpp>
+#include <speller/letter.hpp>
+#include <speller/locale.hpp>
+#include <speller/word.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+static std::vector<std::uint64_t> accumulate_weights(const std::vector<size_t>& weights, const char* name)
+{
+    std::vector<std::uint64_t> cumulative;
+    cumulative.reserve(weights.size());
+    std::uint64_t total = 0;
+    for (size_t weight : weights) {
+        total += weight;
+        cumulative.push_back(total);
+    }
+    if (total == 0) {
+        throw std::invalid_argument(std::string("Dictionary profile has no nonzero ") + name + " weight");
+    }
+    return cumulative;
+}
+
+DictionaryProfile default_dictionary_profile(const std::string& locale_name)
+{
+    const Locale locale(locale_name);
+    DictionaryProfile profile;
+    profile.letter_weights.assign(locale.get_alphabet().size(), 1);
+    profile.length_weights = { 0, 1, 4, 10, 18, 24, 26, 24, 20, 15, 10, 7, 4, 2, 1, 1 };
+    profile.word_count_weights = { 0, 80, 17, 3 };
+    profile.capitalized_per_mille = 20;
+    return profile;
+}
+
+DictionaryProfile dictionary_profile_from_entries(const std::vector<std::string_view>& entries, const std::string& locale_name)
+{
+    const Locale locale(locale_name);
+    const Alphabet& alphabet = locale.get_alphabet();
+    DictionaryProfile profile;
+    profile.letter_weights.resize(alphabet.size());
+    size_t num_capitalized = 0;
+    size_t num_counted = 0;
+    for (std::string_view entry : entries) {
+        const Word word(std::string(entry), locale_name);
+        size_t num_words = 0;
+        size_t length = 0;
+        auto end_word = [&]() {
+            if (length == 0) {
+                return;
+            }
+            if (profile.length_weights.size() <= length) {
+                profile.length_weights.resize(length + 1);
+            }
+            profile.length_weights[length]++;
+            num_words++;
+            length = 0;
+        };
+        for (size_t i = 0; i < word.length(); i++) {
+            const Alphabet::LetterClass letter_class = alphabet.classify(word[i]);
+            if (letter_class == Alphabet::LetterClass::space) {
+                end_word();
+                continue;
+            }
+            if (letter_class == Alphabet::LetterClass::foreign) {
+                continue;
+            }
+            const LetterId id = alphabet.get_letter_id(word[i]);
+            if (num_words == 0 && length == 0 && alphabet.tolower(word[i]).string_view() != word[i].string_view()) {
+                num_capitalized++;
+            }
+            profile.letter_weights[id]++;
+            length++;
+        }
+        end_word();
+        if (num_words == 0) {
+            continue;
+        }
+        if (profile.word_count_weights.size() <= num_words) {
+            profile.word_count_weights.resize(num_words + 1);
+        }
+        profile.word_count_weights[num_words]++;
+        num_counted++;
+    }
+    if (num_counted == 0) {
+        throw std::invalid_argument("No entry contains a letter of the alphabet");
+    }
+    profile.capitalized_per_mille = num_capitalized * 1000 / num_counted;
+    return profile;
+}
+
+DictionaryGenerator::DictionaryGenerator(const DictionaryProfile& profile, const std::string& locale_name, std::uint64_t seed)
+    : cumulative_letter_weights(accumulate_weights(profile.letter_weights, "letter"))
+    , cumulative_length_weights(accumulate_weights(profile.length_weights, "length"))
+    , cumulative_word_count_weights(accumulate_weights(profile.word_count_weights, "word count"))
+    , capitalized_per_mille(profile.capitalized_per_mille)
+    , state(seed)
+{
+    const Locale locale(locale_name);
+    const Alphabet& alphabet = locale.get_alphabet();
+    if (profile.letter_weights.size() > alphabet.size()) {
+        throw std::invalid_argument("Dictionary profile has more letters than the alphabet");
+    }
+    for (size_t id = 0; id < profile.letter_weights.size(); id++) {
+        const Letter lowercase = alphabet.get_lowercase_letter(static_cast<LetterId>(id));
+        lowercase_letters.push_back(lowercase.string());
+        uppercase_letters.push_back(alphabet.toupper(lowercase).string());
+    }
+}
+
+void DictionaryGenerator::append_next(std::string& str)
+{
+    const size_t num_words = pick(cumulative_word_count_weights);
+    const bool capitalized = (next_random() % 1000 < capitalized_per_mille);
+    for (size_t w = 0; w < num_words; w++) {
+        if (w != 0) {
+            str += ' ';
+        }
+        const size_t length = pick(cumulative_length_weights);
+        for (size_t i = 0; i < length; i++) {
+            const size_t id = pick(cumulative_letter_weights);
+            str += (capitalized && w == 0 && i == 0) ? uppercase_letters[id] : lowercase_letters[id];
+        }
+    }
+}
+
+std::string DictionaryGenerator::next()
+{
+    std::string str;
+    append_next(str);
+    return str;
+}
+
+std::uint64_t DictionaryGenerator::next_random() noexcept
+{
+    // SplitMix64
+    std::uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+size_t DictionaryGenerator::pick(const std::vector<std::uint64_t>& cumulative_weights) noexcept
+{
+    // the modulo bias is negligible for totals far below 2^64
+    const std::uint64_t value = next_random() % cumulative_weights.back();
+    const auto it = std::upper_bound(cumulative_weights.begin(), cumulative_weights.end(), value);
+    return static_cast<size_t>(it - cumulative_weights.begin());
+}
+
+} // namespace speller
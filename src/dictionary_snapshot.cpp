@@ -0,0 +1,71 @@
+#include <speller/dictionary_snapshot.hpp>
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Headers
+#include <speller/alphabet.hpp>
+#include <speller/entry_store.hpp>
+#include <speller/letter_trie.hpp>
+#include <speller/utility.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+// add locale under a unique name, which is removed when the last snapshot that shares it is freed
+static std::shared_ptr<const std::string> add_snapshot_locale(const std::string& locale_name, Alphabet alphabet)
+{
+    return std::shared_ptr<const std::string>(new std::string(Locale::add_unique_locale(locale_name, std::move(alphabet))), [](const std::string* unique_name) {
+        Locale::remove_locale(*unique_name);
+        delete unique_name;
+    });
+}
+
+std::vector<std::filesystem::path> DictionaryFiles::get_paths() const
+{
+    std::vector<std::filesystem::path> paths { speller_path };
+    if (!alphabet_path.empty()) {
+        paths.push_back(alphabet_path);
+    }
+    if (!scores_path.empty()) {
+        paths.push_back(scores_path);
+    }
+    return paths;
+}
+
+LiveSnapshot<DictionarySnapshot>::Loader dictionary_snapshot_loader(DictionaryFiles files, IndexBuilder build_indexes)
+{
+    return [files = std::move(files), build_indexes = std::move(build_indexes)](const DictionarySnapshot* previous) {
+        // add locale, unless the alphabet is unchanged
+        std::string alphabet_content;
+        std::shared_ptr<const std::string> added_locale_name;
+        if (!files.alphabet_path.empty()) {
+            alphabet_content = util::file_to_string(files.alphabet_path);
+            if (previous && previous->alphabet_content == alphabet_content) {
+                added_locale_name = previous->added_locale_name;
+            } else {
+                added_locale_name = add_snapshot_locale(files.locale_name, alphabet_from_file(files.alphabet_path.string()));
+            }
+        }
+        const std::string& locale_name = added_locale_name ? *added_locale_name : files.locale_name;
+
+        // read letter scores
+        std::vector<size_t> letter_scores;
+        if (!files.scores_path.empty()) {
+            letter_scores = letter_scores_from_file(files.scores_path.string(), locale_name);
+        }
+
+        // read speller content, rebuilding the indexes of the previous snapshot
+        Dictionary dictionary(EntryStore::from_file(files.speller_path), locale_name, previous ? &previous->dictionary : nullptr);
+        if (build_indexes) {
+            build_indexes(dictionary);
+        }
+        return std::make_shared<const DictionarySnapshot>(DictionarySnapshot { std::move(alphabet_content), std::move(added_locale_name), std::move(letter_scores), std::move(dictionary) });
+    };
+}
+
+} // namespace speller
@@ -0,0 +1,141 @@
+#include <speller/entry_statistics.hpp>
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Headers
+#include <speller/locale.hpp>
+#include <speller/word.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+EntryStatistics::EntryStatistics(const EntryStore& store, const std::string& locale_name)
+{
+    if (store.size() > std::numeric_limits<std::uint32_t>::max()) {
+        throw std::length_error("Too many entries for entry statistics");
+    }
+    const Locale locale(locale_name);
+    const Alphabet& alphabet = locale.get_alphabet();
+    entry_counts.resize(alphabet.size());
+    letter_counts.resize(alphabet.size());
+    // entries of no letters form the first group, even if there are none
+    alphabet_only_counts.resize(1);
+
+    // analyze letters of each entry
+    std::vector<size_t> lengths(store.size());
+    std::vector<LetterMask> masks(store.size());
+    for (size_t id = 0; id < store.size(); id++) {
+        const Word word(std::string(store[id]), locale_name);
+        bool alphabet_only = (word.length() != 0);
+        for (size_t i = 0; i < word.length(); i++) {
+            const LetterId letter_id = alphabet.get_letter_id(word[i]);
+            if (letter_id == Alphabet::foreign_letter_id) {
+                alphabet_only = false;
+                continue;
+            }
+            letter_counts[letter_id]++;
+            if (letter_id < std::numeric_limits<LetterMask>::digits) {
+                masks[id] |= LetterMask(1) << letter_id;
+            }
+        }
+        for (size_t letter_id = 0; letter_id < alphabet.size(); letter_id++) {
+            entry_counts[letter_id] += (masks[id] >> letter_id) & 1;
+        }
+        lengths[id] = word.length();
+        total_letter_count += word.length();
+        if (alphabet_only_counts.size() <= word.length()) {
+            alphabet_only_counts.resize(word.length() + 1);
+        }
+        alphabet_only_counts[word.length()] += alphabet_only;
+    }
+
+    // group entries by length, keeping identifiers in ascending order
+    length_offsets.assign(alphabet_only_counts.size() + 1, 0);
+    for (size_t length : lengths) {
+        length_offsets[length + 1]++;
+    }
+    for (size_t length = 1; length < length_offsets.size(); length++) {
+        length_offsets[length] += length_offsets[length - 1];
+    }
+    ids_by_length.resize(store.size());
+    masks_by_length.resize(store.size());
+    std::vector<std::uint32_t> next(length_offsets.begin(), length_offsets.end() - 1);
+    for (size_t id = 0; id < store.size(); id++) {
+        const std::uint32_t position = next[lengths[id]]++;
+        ids_by_length[position] = static_cast<std::uint32_t>(id);
+        masks_by_length[position] = masks[id];
+    }
+}
+
+size_t EntryStatistics::size() const noexcept
+{
+    return ids_by_length.size();
+}
+
+size_t EntryStatistics::count_length(size_t min_length, size_t max_length) const noexcept
+{
+    const size_t num_lengths = length_offsets.size() - 1;
+    min_length = std::min(min_length, num_lengths);
+    max_length = std::min(max_length, num_lengths - 1);
+    if (min_length > max_length) {
+        return 0;
+    }
+    return length_offsets[max_length + 1] - length_offsets[min_length];
+}
+
+size_t EntryStatistics::count_alphabet_only(size_t length) const noexcept
+{
+    return (length < alphabet_only_counts.size()) ? alphabet_only_counts[length] : 0;
+}
+
+double EntryStatistics::get_entry_frequency(LetterId id) const noexcept
+{
+    if (id >= entry_counts.size() || size() == 0) {
+        return 0;
+    }
+    return static_cast<double>(entry_counts[id]) / size();
+}
+
+double EntryStatistics::get_letter_frequency(LetterId id) const noexcept
+{
+    if (id >= letter_counts.size() || total_letter_count == 0) {
+        return 0;
+    }
+    return static_cast<double>(letter_counts[id]) / total_letter_count;
+}
+
+std::vector<size_t> EntryStatistics::find(size_t min_length, size_t max_length, LetterMask required) const
+{
+    const size_t num_lengths = length_offsets.size() - 1;
+    min_length = std::min(min_length, num_lengths);
+    max_length = std::min(max_length, num_lengths - 1);
+    if (min_length > max_length) {
+        return {};
+    }
+    std::vector<size_t> results;
+    for (size_t i = length_offsets[min_length]; i < length_offsets[max_length + 1]; i++) {
+        if ((masks_by_length[i] & required) == required) {
+            results.push_back(ids_by_length[i]);
+        }
+    }
+    // each length is in ascending order on its own
+    if (min_length != max_length) {
+        std::sort(results.begin(), results.end());
+    }
+    return results;
+}
+
+size_t EntryStatistics::get_memory_size() const noexcept
+{
+    return (length_offsets.capacity() + ids_by_length.capacity()) * sizeof(std::uint32_t)
+        + masks_by_length.capacity() * sizeof(LetterMask)
+        + (alphabet_only_counts.capacity() + entry_counts.capacity() + letter_counts.capacity()) * sizeof(size_t);
+}
+
+} // namespace speller
@@ -0,0 +1,73 @@
+#include <speller/entry_store.hpp>
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Headers
+#include <speller/utf8.hpp>
+#include <speller/utility.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+EntryStore::EntryStore(std::string content_value)
+    : content(std::move(content_value))
+{
+    validate_utf8(content);
+    // similar to std::getline, the last line may lack a line feed
+    size_t offset = 0;
+    while (offset < content.size()) {
+        std::string::size_type end = content.find('\n', offset);
+        if (end == std::string::npos) {
+            end = content.size();
+        }
+        spans.push_back({ offset, end - offset });
+        offset = end + 1;
+    }
+}
+
+EntryStore EntryStore::from_file(const std::filesystem::path& filename)
+{
+    try {
+        return EntryStore(util::file_to_string(filename));
+    } catch (const std::invalid_argument& e) {
+        throw std::runtime_error(std::string(e.what()) + " in speller file: " + filename.string());
+    }
+}
+
+size_t EntryStore::size() const noexcept
+{
+    return spans.size();
+}
+
+std::string_view EntryStore::operator[](size_t id) const& noexcept
+{
+    const Span& span = spans[id];
+    return std::string_view(content.data() + span.offset, span.length);
+}
+
+EntryHandle EntryStore::get_handle(size_t id) const& noexcept
+{
+    return { id, (*this)[id] };
+}
+
+std::vector<std::string_view> EntryStore::get_entries() const&
+{
+    std::vector<std::string_view> entries;
+    entries.reserve(spans.size());
+    for (size_t id = 0; id < spans.size(); id++) {
+        entries.push_back((*this)[id]);
+    }
+    return entries;
+}
+
+const std::string& EntryStore::get_content() const& noexcept
+{
+    return content;
+}
+
+} // namespace speller
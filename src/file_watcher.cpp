@@ -0,0 +1,108 @@
+#include <speller/file_watcher.hpp>
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// System Headers
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+// editors save in several steps, wait for them to settle before reporting
+static constexpr std::chrono::milliseconds settle_duration(100);
+
+FileWatcher::FileWatcher(std::vector<std::filesystem::path> paths_value)
+    : paths(std::move(paths_value))
+{
+    for (const std::filesystem::path& path : paths) {
+        if (!std::filesystem::exists(path)) {
+            throw std::runtime_error("Watched file does not exist: " + path.string());
+        }
+        write_times.push_back(std::filesystem::last_write_time(path));
+    }
+#ifdef __linux__
+    inotify_fd = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotify_fd < 0) {
+        // polling still works
+        return;
+    }
+    std::set<std::filesystem::path> directories;
+    for (const std::filesystem::path& path : paths) {
+        directories.insert(std::filesystem::absolute(path).parent_path());
+    }
+    constexpr std::uint32_t mask = IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE;
+    for (const std::filesystem::path& directory : directories) {
+        if (::inotify_add_watch(inotify_fd, directory.c_str(), mask) < 0) {
+            ::close(inotify_fd);
+            inotify_fd = -1;
+            return;
+        }
+    }
+#endif
+}
+
+FileWatcher::~FileWatcher()
+{
+#ifdef __linux__
+    if (inotify_fd >= 0) {
+        ::close(inotify_fd);
+    }
+#endif
+}
+
+bool FileWatcher::wait_for_change(std::chrono::milliseconds timeout)
+{
+#ifdef __linux__
+    if (inotify_fd >= 0) {
+        pollfd pfd { inotify_fd, POLLIN, 0 };
+        if (::poll(&pfd, 1, static_cast<int>(timeout.count())) <= 0) {
+            return false;
+        }
+        std::this_thread::sleep_for(settle_duration);
+        // drain pending events, the write times tell whether a watched file is among them
+        alignas(inotify_event) char buffer[4096];
+        while (::read(inotify_fd, buffer, sizeof(buffer)) > 0) {
+        }
+        return poll_write_times();
+    }
+#endif
+    std::this_thread::sleep_for(timeout);
+    if (!poll_write_times()) {
+        return false;
+    }
+    std::this_thread::sleep_for(settle_duration);
+    poll_write_times();
+    return true;
+}
+
+bool FileWatcher::poll_write_times()
+{
+    bool changed = false;
+    for (size_t i = 0; i < paths.size(); i++) {
+        std::error_code ec;
+        const std::filesystem::file_time_type write_time = std::filesystem::last_write_time(paths[i], ec);
+        // a file being replaced may be missing for a moment
+        if (ec) {
+            continue;
+        }
+        if (write_time != write_times[i]) {
+            write_times[i] = write_time;
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+} // namespace speller
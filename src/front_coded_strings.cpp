@@ -0,0 +1,241 @@
+#include <speller/front_coded_strings.hpp>
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+// identifies the binary format of saved strings
+static constexpr std::string_view file_magic = "SPELLFC1";
+
+static void append_size(std::string& data, size_t value)
+{
+    while (value >= 0x80) {
+        data += static_cast<char>((value & 0x7F) | 0x80);
+        value >>= 7;
+    }
+    data += static_cast<char>(value);
+}
+
+// similar to FrontCodedStrings::read_size, failing instead of reading past end
+static bool read_size_checked(const char*& position, const char* end, size_t& value)
+{
+    value = 0;
+    for (int shift = 0; shift < 64 && position != end; shift += 7) {
+        const auto byte = static_cast<unsigned char>(*position++);
+        value |= static_cast<size_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void write_fixed(std::ostream& os, size_t value)
+{
+    const auto fixed = static_cast<std::uint64_t>(value);
+    os.write(reinterpret_cast<const char*>(&fixed), sizeof(fixed));
+}
+
+static size_t read_fixed(std::istream& is)
+{
+    std::uint64_t fixed;
+    if (!is.read(reinterpret_cast<char*>(&fixed), sizeof(fixed))) {
+        throw std::runtime_error("Front coded strings are truncated");
+    }
+    return static_cast<size_t>(fixed);
+}
+
+FrontCodedStrings::FrontCodedStrings()
+    : num_strings(0)
+{
+}
+
+FrontCodedStrings::FrontCodedStrings(const std::vector<std::string_view>& sorted_strings)
+    : num_strings(sorted_strings.size())
+{
+    block_offsets.reserve((num_strings + block_size - 1) / block_size);
+    std::string_view previous;
+    for (size_t index = 0; index < num_strings; index++) {
+        const std::string_view str = sorted_strings[index];
+        if (index != 0 && !(previous < str)) {
+            throw std::invalid_argument("Front coded strings must be sorted and distinct");
+        }
+        if (index % block_size == 0) {
+            // first string of a block in full
+            block_offsets.push_back(data.size());
+            append_size(data, str.size());
+            data.append(str);
+        } else {
+            const size_t shared_size = std::mismatch(previous.begin(), previous.end(), str.begin(), str.end()).first - previous.begin();
+            append_size(data, shared_size);
+            append_size(data, str.size() - shared_size);
+            data.append(str.substr(shared_size));
+        }
+        previous = str;
+    }
+    data.shrink_to_fit();
+}
+
+FrontCodedStrings FrontCodedStrings::load(std::istream& is)
+{
+    std::string magic(file_magic.size(), '\0');
+    if (!is.read(magic.data(), magic.size()) || magic != file_magic) {
+        throw std::runtime_error("Stream does not contain front coded strings");
+    }
+    FrontCodedStrings result;
+    result.num_strings = read_fixed(is);
+    const size_t num_blocks = read_fixed(is);
+    const size_t data_size = read_fixed(is);
+    if (num_blocks != (result.num_strings + block_size - 1) / block_size) {
+        throw std::runtime_error("Front coded strings are corrupt");
+    }
+    result.block_offsets.resize(num_blocks);
+    for (size_t& offset : result.block_offsets) {
+        offset = read_fixed(is);
+    }
+    result.data.resize(data_size);
+    if (!is.read(result.data.data(), data_size)) {
+        throw std::runtime_error("Front coded strings are truncated");
+    }
+
+    // decoding trusts the data, so check every string once
+    const char* const end = result.data.data() + data_size;
+    for (size_t block_index = 0; block_index < num_blocks; block_index++) {
+        const size_t offset = result.block_offsets[block_index];
+        const size_t block_end = (block_index + 1 < num_blocks) ? result.block_offsets[block_index + 1] : data_size;
+        if (offset > block_end || block_end > data_size) {
+            throw std::runtime_error("Front coded strings are corrupt");
+        }
+        const char* position = result.data.data() + offset;
+        const size_t block_strings = std::min(block_size, result.num_strings - block_index * block_size);
+        size_t previous_size = 0;
+        for (size_t i = 0; i < block_strings; i++) {
+            size_t shared_size = 0;
+            size_t suffix_size = 0;
+            const bool valid = (i == 0 || read_size_checked(position, end, shared_size))
+                && read_size_checked(position, end, suffix_size)
+                && shared_size <= previous_size
+                && suffix_size <= static_cast<size_t>(end - position);
+            if (!valid) {
+                throw std::runtime_error("Front coded strings are corrupt");
+            }
+            position += suffix_size;
+            previous_size = shared_size + suffix_size;
+        }
+        if (position != result.data.data() + block_end) {
+            throw std::runtime_error("Front coded strings are corrupt");
+        }
+    }
+    return result;
+}
+
+void FrontCodedStrings::save(std::ostream& os) const
+{
+    os.write(file_magic.data(), file_magic.size());
+    write_fixed(os, num_strings);
+    write_fixed(os, block_offsets.size());
+    write_fixed(os, data.size());
+    for (size_t offset : block_offsets) {
+        write_fixed(os, offset);
+    }
+    os.write(data.data(), data.size());
+    if (!os) {
+        throw std::runtime_error("Failed to write front coded strings");
+    }
+}
+
+size_t FrontCodedStrings::size() const noexcept
+{
+    return num_strings;
+}
+
+std::string FrontCodedStrings::at(size_t index) const
+{
+    if (index >= num_strings) {
+        throw std::out_of_range("Front coded string index is out of range");
+    }
+    std::string result;
+    for_each(index, index + 1, [&result](size_t, std::string_view str) {
+        result = str;
+        return false;
+    });
+    return result;
+}
+
+std::string_view FrontCodedStrings::get_block_head(size_t block_index) const noexcept
+{
+    const char* position = data.data() + block_offsets[block_index];
+    const size_t size = read_size(position);
+    return std::string_view(position, size);
+}
+
+template <typename Predicate>
+size_t FrontCodedStrings::partition_point(Predicate predicate) const
+{
+    // last block whose first string satisfies predicate
+    size_t low = 0;
+    size_t high = block_offsets.size();
+    while (low < high) {
+        const size_t middle = low + (high - low) / 2;
+        if (predicate(get_block_head(middle))) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    if (low == 0) {
+        return 0;
+    }
+    // first string within that block that does not satisfy predicate
+    const size_t block_begin = (low - 1) * block_size;
+    size_t result = std::min(block_begin + block_size, num_strings);
+    for_each(block_begin + 1, result, [&predicate, &result](size_t index, std::string_view str) {
+        if (predicate(str)) {
+            return true;
+        }
+        result = index;
+        return false;
+    });
+    return result;
+}
+
+size_t FrontCodedStrings::lower_bound(std::string_view key) const
+{
+    return partition_point([key](std::string_view str) { return str < key; });
+}
+
+size_t FrontCodedStrings::find(std::string_view key) const
+{
+    const size_t index = lower_bound(key);
+    bool found = false;
+    for_each(index, index + 1, [key, &found](size_t, std::string_view str) {
+        found = (str == key);
+        return false;
+    });
+    return found ? index : npos;
+}
+
+std::pair<size_t, size_t> FrontCodedStrings::find_prefix(std::string_view prefix) const
+{
+    const size_t begin = lower_bound(prefix);
+    const size_t end = partition_point([prefix](std::string_view str) { return str.substr(0, prefix.size()) <= prefix; });
+    return { begin, end };
+}
+
+size_t FrontCodedStrings::get_memory_size() const noexcept
+{
+    return data.capacity() + block_offsets.capacity() * sizeof(size_t);
+}
+
+} // namespace speller
@@ -0,0 +1,58 @@
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Headers
+#include <speller/alphabet.hpp>
+#include <speller/dictionary_generator.hpp>
+#include <speller/entry_store.hpp>
+#include <speller/locale.hpp>
+#include <speller/utility.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char** argv)
+try {
+    // Split command line arguments
+    const util::Arguments arguments = util::parse_arguments(argc, argv);
+    const std::vector<std::string>& positional = arguments.positional;
+
+    // Obtain generation parameters
+    const size_t count = util::get_option(arguments, "count", size_t(1000000));
+    const std::uint64_t seed = util::get_option(arguments, "seed", std::uint64_t(1));
+
+    // Obtain alphabet resource file, if specified
+    std::string locale_name = speller::Locale::default_locale_name;
+    if (positional.size() > 0) {
+        const std::filesystem::path alphabet_path = positional[0];
+        speller::Alphabet alphabet = speller::alphabet_from_file(alphabet_path.string());
+        locale_name = speller::Locale::add_unique_locale(alphabet_path.stem().string(), std::move(alphabet));
+    }
+
+    // Obtain distributions from a sample dictionary, if specified
+    speller::DictionaryProfile profile = speller::default_dictionary_profile(locale_name);
+    if (positional.size() > 1) {
+        const speller::EntryStore sample = speller::EntryStore::from_file(positional[1]);
+        profile = speller::dictionary_profile_from_entries(sample.get_entries(), locale_name);
+    }
+
+    // Print entries, since standard output is reserved for them
+    speller::DictionaryGenerator generator(profile, locale_name, seed);
+    util::OutputBuffer output;
+    std::string entry;
+    for (size_t i = 0; i < count; i++) {
+        entry.clear();
+        generator.append_next(entry);
+        output << entry << '\n';
+    }
+    output.flush();
+} catch (const std::exception& e) {
+    // Print error and exit
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,259 @@
+#include <speller/letter_matrix.hpp>
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Headers
+#include <speller/alphabet.hpp>
+#include <speller/letter.hpp>
+#include <speller/locale.hpp>
+#include <speller/word.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+static constexpr size_t max_alphabet_size = std::numeric_limits<LetterMask>::digits;
+
+static LetterMask get_all_letters_mask(size_t alphabet_size)
+{
+    if (alphabet_size >= max_alphabet_size) {
+        return ~LetterMask(0);
+    }
+    return (LetterMask(1) << alphabet_size) - 1;
+}
+
+LetterSetQuery parse_letter_set_query(const std::string& query, const std::string& locale_name)
+{
+    const Locale locale(locale_name);
+    const Alphabet& alphabet = locale.get_alphabet();
+    if (alphabet.size() > max_alphabet_size) {
+        throw std::invalid_argument("Alphabet contains too many letters for a letter set query");
+    }
+    const LetterMask all_letters = get_all_letters_mask(alphabet.size());
+
+    LetterSetQuery result;
+    result.required_letter_counts.resize(alphabet.size());
+    auto get_letter_id = [&alphabet](Letter letter) {
+        const LetterId id = alphabet.get_letter_id(letter);
+        if (id == Alphabet::foreign_letter_id) {
+            throw std::invalid_argument("Letter does not exist in the alphabet: " + letter.string());
+        }
+        return id;
+    };
+
+    const Word word(query, locale_name);
+    // whether the required letters section is reached
+    bool in_required = false;
+    // whether a letter set is open
+    bool in_set = false;
+    LetterMask set_mask = 0;
+    for (size_t i = 0; i < word.length(); i++) {
+        const std::string_view sw = word[i].string_view();
+        if (in_required) {
+            result.required_letter_counts[get_letter_id(sw)]++;
+        } else if (in_set) {
+            if (sw == "]") {
+                if (set_mask == 0) {
+                    throw std::invalid_argument("Empty letter set in query: " + query);
+                }
+                result.position_masks.push_back(set_mask);
+                in_set = false;
+            } else {
+                set_mask |= LetterMask(1) << get_letter_id(sw);
+            }
+        } else if (sw == "[") {
+            in_set = true;
+            set_mask = 0;
+        } else if (sw == "?") {
+            result.position_masks.push_back(all_letters);
+        } else if (sw == "/") {
+            in_required = true;
+        } else {
+            result.position_masks.push_back(LetterMask(1) << get_letter_id(sw));
+        }
+    }
+    if (in_set) {
+        throw std::invalid_argument("Unterminated letter set in query: " + query);
+    }
+    return result;
+}
+
+bool matches_letter_set(const LetterSetQuery& query, std::string_view word_str, const std::string& locale_name)
+{
+    const Locale locale(locale_name);
+    const Alphabet& alphabet = locale.get_alphabet();
+    const Word word(std::string(word_str), locale_name);
+    const size_t length = query.position_masks.size();
+    if (length == 0 || word.length() != length) {
+        return false;
+    }
+    // words containing characters that do not exist in the alphabet are not stored
+    std::vector<size_t> counts(alphabet.size());
+    for (size_t position = 0; position < length; position++) {
+        const LetterId id = alphabet.get_letter_id(word[position]);
+        if (id == Alphabet::foreign_letter_id || id >= max_alphabet_size || ((query.position_masks[position] >> id) & 1) == 0) {
+            return false;
+        }
+        counts[id]++;
+    }
+    for (size_t id = 0; id < query.required_letter_counts.size(); id++) {
+        if (query.required_letter_counts[id] != 0 && (id >= counts.size() || counts[id] < query.required_letter_counts[id])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+LetterMatrix::LetterMatrix(const std::vector<std::string_view>& words, const std::string& locale_name)
+{
+    const Locale locale(locale_name);
+    const Alphabet& alphabet = locale.get_alphabet();
+    alphabet_size = alphabet.size();
+    if (alphabet_size > max_alphabet_size) {
+        throw std::invalid_argument("Alphabet contains too many letters for a letter matrix");
+    }
+
+    // collect letter identifiers row by row
+    std::vector<std::vector<LetterId>> row_major_ids;
+    std::vector<LetterId> ids;
+    for (size_t index = 0; index < words.size(); index++) {
+        const Word word(std::string(words[index]), locale_name);
+        ids.clear();
+        for (size_t i = 0; i < word.length(); i++) {
+            ids.push_back(alphabet.get_letter_id(word[i]));
+        }
+        if (ids.empty() || std::count(ids.begin(), ids.end(), Alphabet::foreign_letter_id)) {
+            continue;
+        }
+        const size_t length = ids.size();
+        if (buckets.size() <= length) {
+            buckets.resize(length + 1);
+            row_major_ids.resize(length + 1);
+        }
+        buckets[length].word_indices.push_back(index);
+        row_major_ids[length].insert(row_major_ids[length].end(), ids.begin(), ids.end());
+    }
+
+    // transpose into columns
+    for (size_t length = 0; length < buckets.size(); length++) {
+        Bucket& bucket = buckets[length];
+        const size_t rows = bucket.word_indices.size();
+        const std::vector<LetterId>& source = row_major_ids[length];
+        bucket.letter_ids.resize(source.size());
+        for (size_t row = 0; row < rows; row++) {
+            for (size_t position = 0; position < length; position++) {
+                bucket.letter_ids[position * rows + row] = source[row * length + position];
+            }
+        }
+    }
+}
+
+std::vector<size_t> LetterMatrix::find(const LetterSetQuery& query) const
+{
+    QueryBudget budget;
+    ResultPage page;
+    return find(query, budget, page);
+}
+
+std::vector<size_t> LetterMatrix::find(const LetterSetQuery& query, QueryBudget& budget, ResultPage& page) const
+{
+    const size_t length = query.position_masks.size();
+    if (length == 0 || length >= buckets.size()) {
+        return {};
+    }
+    const Bucket& bucket = buckets[length];
+    const size_t rows = bucket.word_indices.size();
+    const LetterMask all_letters = get_all_letters_mask(alphabet_size);
+    auto get_column = [&bucket, rows](size_t position) {
+        return bucket.letter_ids.data() + position * rows;
+    };
+
+    // test the most selective positions first
+    std::vector<size_t> positions(length);
+    std::iota(positions.begin(), positions.end(), 0);
+    auto count_letters = [&query, all_letters](size_t position) {
+        return std::bitset<max_alphabet_size>(query.position_masks[position] & all_letters).count();
+    };
+    std::stable_sort(positions.begin(), positions.end(),
+        [&count_letters](size_t lhs, size_t rhs) { return count_letters(lhs) < count_letters(rhs); });
+
+    // rows that satisfy every position tested so far
+    std::vector<size_t> candidates(rows);
+    std::iota(candidates.begin(), candidates.end(), 0);
+    for (size_t position : positions) {
+        const LetterMask mask = query.position_masks[position] & all_letters;
+        // every stored letter passes
+        if (mask == all_letters) {
+            continue;
+        }
+        std::array<std::uint8_t, std::numeric_limits<LetterId>::max() + 1> accepted {};
+        for (size_t id = 0; id < alphabet_size; id++) {
+            accepted[id] = (mask >> id) & 1;
+        }
+        if (!budget.visit_candidates(candidates.size())) {
+            return {};
+        }
+        // branchless compaction of surviving rows
+        const LetterId* const column = get_column(position);
+        size_t kept = 0;
+        for (size_t row : candidates) {
+            candidates[kept] = row;
+            kept += accepted[column[row]];
+        }
+        candidates.resize(kept);
+        if (candidates.empty()) {
+            break;
+        }
+    }
+
+    // check letters that must be contained
+    const std::vector<size_t>& required = query.required_letter_counts;
+    const bool has_required = std::any_of(required.begin(), required.end(), [](size_t count) { return count != 0; });
+    std::vector<size_t> results;
+    std::array<size_t, max_alphabet_size> counts;
+    for (size_t row : candidates) {
+        if (page.is_complete()) {
+            page.stop();
+            break;
+        }
+        if (has_required) {
+            if (!budget.visit_candidates()) {
+                break;
+            }
+            counts.fill(0);
+            for (size_t position = 0; position < length; position++) {
+                counts[get_column(position)[row]]++;
+            }
+            bool satisfied = true;
+            for (size_t id = 0; id < required.size() && satisfied; id++) {
+                satisfied = (counts[id] >= required[id]);
+            }
+            if (!satisfied) {
+                continue;
+            }
+        }
+        if (!page.take()) {
+            continue;
+        }
+        if (!budget.add_result()) {
+            break;
+        }
+        results.push_back(bucket.word_indices[row]);
+    }
+    return results;
+}
+
+size_t LetterMatrix::count_words(size_t length) const noexcept
+{
+    return (length < buckets.size()) ? buckets[length].word_indices.size() : 0;
+}
+
+} // namespace speller
@@ -0,0 +1,124 @@
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Headers
+#include <speller/dictionary.hpp>
+#include <speller/dictionary_snapshot.hpp>
+#include <speller/letter_matrix.hpp>
+#include <speller/live_snapshot.hpp>
+#include <speller/query_budget.hpp>
+#include <speller/query_planner.hpp>
+#include <speller/result_page.hpp>
+#include <speller/utility.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char** argv)
+try {
+    // Split command line arguments
+    const util::Arguments arguments = util::parse_arguments(argc, argv);
+    const std::vector<std::string>& positional = arguments.positional;
+
+    // Obtain speller resource file path
+    speller::DictionaryFiles files;
+    files.speller_path = (positional.size() > 0) ? positional[0] : "tr.txt";
+    std::cout << "Speller filename: " << files.speller_path.string() << "\n";
+
+    // Obtain alphabet resource file, if specified
+    if (positional.size() > 1) {
+        // Print configuration
+        files.alphabet_path = positional[1];
+        files.locale_name = (positional.size() > 2) ? positional[2] : files.speller_path.stem().string();
+        std::cout << "Alphabet filename: " << files.alphabet_path.string() << "\n";
+        std::cout << "Locale: " << files.locale_name << std::endl;
+    }
+    std::cout << std::endl;
+
+    // Obtain query limits
+    speller::QueryLimits limits;
+    limits.timeout = std::chrono::milliseconds(util::get_option(arguments, "timeout-ms", limits.timeout.count()));
+    limits.max_candidates = util::get_option(arguments, "max-candidates", limits.max_candidates);
+    limits.max_results = util::get_option(arguments, "max-results", limits.max_results);
+
+    // Obtain result page
+    const size_t offset = util::get_option(arguments, "offset", size_t(0));
+    const size_t limit = util::get_option(arguments, "limit", speller::ResultPage::unlimited);
+    const bool count_only = util::has_option(arguments, "count-only");
+
+    // Describe the plan of each query, if requested
+    const bool explain = util::has_option(arguments, "explain");
+
+    // Watch resource files, if requested
+    const std::vector<std::filesystem::path> watched_paths = util::has_option(arguments, "watch") ? files.get_paths() : std::vector<std::filesystem::path>();
+
+    // Load resources, then group letters by word length and gather statistics
+    auto build_indexes = [](const speller::Dictionary& dictionary) {
+        dictionary.get_letter_matrix();
+        dictionary.get_statistics();
+    };
+    const speller::LiveSnapshot<speller::DictionarySnapshot> live(speller::dictionary_snapshot_loader(files, build_indexes), watched_paths);
+
+    // Configure standard input
+    util::enable_exceptions(std::cin);
+    std::cin.tie(&std::cout);
+
+    // Configure standard output for matches
+    util::OutputBuffer output;
+
+    // Run in an infinite loop
+    size_t snapshot_version = 0;
+    size_t num_failures = 0;
+    while (true) {
+        // Report background reloads
+        if (live.get_version() != snapshot_version) {
+            snapshot_version = live.get_version();
+            std::cout << "Resources reloaded.\n";
+        }
+        if (live.get_num_failures() != num_failures) {
+            num_failures = live.get_num_failures();
+            std::cout << "Reload failed, using previous resources: " << live.get_last_error() << "\n";
+        }
+
+        // Obtain search string
+        std::cout << "Search: ";
+        std::string search_str;
+        std::cin >> search_str;
+
+        // Use the same snapshot for the whole query
+        const std::shared_ptr<const speller::DictionarySnapshot> snapshot = live.get();
+
+        // Obtain matches
+        const speller::LetterSetQuery query = speller::parse_letter_set_query(search_str, snapshot->dictionary.get_locale_name());
+        const speller::QueryPlan plan = explain ? snapshot->dictionary.plan_letter_set(query) : speller::QueryPlan();
+        speller::QueryBudget budget(limits);
+        speller::ResultPage page(offset, limit, count_only);
+        const std::vector<size_t> results = snapshot->dictionary.find_letter_set(query, budget, page);
+
+        // Print matches
+        if (explain) {
+            output << "Plan: " << speller::describe_plan(plan, snapshot->dictionary.get_locale_name()) << "\n";
+            output << "Candidates: " << static_cast<size_t>(plan.estimated_candidates + 0.5) << " estimated, " << budget.get_num_candidates() << " actual.\n";
+        }
+        const char* const lower_bound_str = (page.is_num_matches_exact() && !budget.is_truncated()) ? "" : "at least ";
+        output << "A total of " << lower_bound_str << page.get_num_matches() << " matches found.\n";
+        if (budget.is_truncated()) {
+            output << "Search truncated: " << budget.get_truncation_reason() << ".\n";
+        }
+        for (size_t index : results) {
+            output << snapshot->dictionary[index] << '\n';
+        }
+        output << '\n';
+        output.flush();
+    }
+} catch (const std::exception& e) {
+    // Print error and exit
+    std::cout << "Exception: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,188 @@
+#include <speller/letter_trie.hpp>
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Headers
+#include <speller/alphabet.hpp>
+#include <speller/letter.hpp>
+#include <speller/locale.hpp>
+#include <speller/word.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+RackQuery parse_rack_query(const std::string& query, const std::string& locale_name)
+{
+    const Locale locale(locale_name);
+    const Alphabet& alphabet = locale.get_alphabet();
+    RackQuery result;
+    result.letter_counts.resize(alphabet.size());
+    const Word word(query, locale_name);
+    for (size_t i = 0; i < word.length(); i++) {
+        if (word[i].string_view() == "?") {
+            result.num_jokers++;
+            continue;
+        }
+        const LetterId id = alphabet.get_letter_id(word[i]);
+        if (id == Alphabet::foreign_letter_id) {
+            throw std::invalid_argument("Letter does not exist in the alphabet: " + word[i].string());
+        }
+        result.letter_counts[id]++;
+    }
+    return result;
+}
+
+std::vector<size_t> letter_scores_from_file(const std::string& filename, const std::string& locale_name)
+{
+    if (!std::filesystem::exists(filename)) {
+        throw std::runtime_error("Score file does not exist: " + filename);
+    }
+    const Locale locale(locale_name);
+    const Alphabet& alphabet = locale.get_alphabet();
+    std::vector<size_t> scores(alphabet.size());
+    std::ifstream ifs(filename);
+    for (std::string line; std::getline(ifs, line);) {
+        constexpr char separator = '\t';
+        const std::string::size_type pos = line.find(separator);
+        if (pos == std::string::npos) {
+            throw std::runtime_error(R"(Score file contains a line without separator tab character (\t): )" + line);
+        }
+        const std::string letter_str = line.substr(0, pos);
+        const LetterId id = alphabet.get_letter_id(letter_str);
+        if (id == Alphabet::foreign_letter_id) {
+            throw std::runtime_error("Score file contains a letter that does not exist in the alphabet: " + letter_str);
+        }
+        scores[id] = std::stoul(line.substr(pos + sizeof(separator)));
+    }
+    return scores;
+}
+
+LetterTrie::LetterTrie(const std::vector<std::string_view>& words, const std::string& locale_name)
+{
+    const Locale locale(locale_name);
+    const Alphabet& alphabet = locale.get_alphabet();
+
+    // build with ordered children first
+    std::vector<std::map<LetterId, std::uint32_t>> children(1);
+    std::vector<std::vector<size_t>> ending_words(1);
+    std::vector<LetterId> ids;
+    for (size_t index = 0; index < words.size(); index++) {
+        const Word word(std::string(words[index]), locale_name);
+        ids.clear();
+        for (size_t i = 0; i < word.length(); i++) {
+            ids.push_back(alphabet.get_letter_id(word[i]));
+        }
+        if (ids.empty() || std::count(ids.begin(), ids.end(), Alphabet::foreign_letter_id)) {
+            continue;
+        }
+        std::uint32_t node = 0;
+        for (LetterId id : ids) {
+            const auto next = static_cast<std::uint32_t>(children.size());
+            bool inserted;
+            std::map<LetterId, std::uint32_t>::iterator it;
+            std::tie(it, inserted) = children[node].insert({ id, next });
+            if (inserted) {
+                children.emplace_back();
+                ending_words.emplace_back();
+            }
+            node = it->second;
+        }
+        ending_words[node].push_back(index);
+    }
+
+    // flatten into contiguous arrays
+    nodes.resize(children.size());
+    for (size_t i = 0; i < children.size(); i++) {
+        Node& node = nodes[i];
+        node.edges_begin = static_cast<std::uint32_t>(edges.size());
+        for (const auto& [id, target] : children[i]) {
+            edges.push_back({ id, target });
+        }
+        node.edges_end = static_cast<std::uint32_t>(edges.size());
+        node.words_begin = static_cast<std::uint32_t>(word_indices.size());
+        word_indices.insert(word_indices.end(), ending_words[i].begin(), ending_words[i].end());
+        node.words_end = static_cast<std::uint32_t>(word_indices.size());
+    }
+}
+
+std::vector<RackMatch> LetterTrie::find_formable(const RackQuery& query, const std::vector<size_t>& letter_scores) const
+{
+    QueryBudget budget;
+    ResultPage page;
+    return find_formable(query, letter_scores, budget, page);
+}
+
+std::vector<RackMatch> LetterTrie::find_formable(const RackQuery& query, const std::vector<size_t>& letter_scores, QueryBudget& budget, ResultPage& page) const
+{
+    std::vector<size_t> remaining = query.letter_counts;
+    size_t remaining_jokers = query.num_jokers;
+    std::vector<LetterId> joker_letter_ids;
+    std::vector<RackMatch> results;
+
+    auto get_score = [&letter_scores](LetterId id) -> size_t {
+        return (id < letter_scores.size()) ? letter_scores[id] : 0;
+    };
+    // whether the walk must stop
+    bool stopped = false;
+    auto visit = [&](auto& self, std::uint32_t node_index, size_t depth, size_t score) -> void {
+        if (!budget.visit_candidates()) {
+            stopped = true;
+            return;
+        }
+        const Node& node = nodes[node_index];
+        for (std::uint32_t i = node.words_begin; i < node.words_end; i++) {
+            // ranking does not change the number of matches
+            if (page.is_count_only()) {
+                page.take();
+                continue;
+            }
+            results.push_back({ word_indices[i], depth, score, joker_letter_ids });
+        }
+        for (std::uint32_t i = node.edges_begin; i < node.edges_end && !stopped; i++) {
+            const Edge& edge = edges[i];
+            // prefer actual letters over jokers
+            if (edge.letter_id < remaining.size() && remaining[edge.letter_id] != 0) {
+                remaining[edge.letter_id]--;
+                self(self, edge.target, depth + 1, score + get_score(edge.letter_id));
+                remaining[edge.letter_id]++;
+            } else if (remaining_jokers != 0) {
+                remaining_jokers--;
+                joker_letter_ids.push_back(edge.letter_id);
+                self(self, edge.target, depth + 1, score);
+                joker_letter_ids.pop_back();
+                remaining_jokers++;
+            }
+        }
+    };
+    visit(visit, 0, 0, 0);
+
+    // rank only as many matches as the page needs
+    const size_t num_skipped = std::min(page.get_offset(), results.size());
+    const size_t num_ranked = num_skipped + std::min(page.get_limit(), results.size() - num_skipped);
+    std::partial_sort(results.begin(), results.begin() + num_ranked, results.end(), [](const RackMatch& lhs, const RackMatch& rhs) {
+        return std::make_tuple(rhs.score, rhs.length, lhs.word_index) < std::make_tuple(lhs.score, lhs.length, rhs.word_index);
+    });
+    // limit results in rank order, so that they are the top ranked matches
+    std::vector<RackMatch> page_results;
+    for (RackMatch& match : results) {
+        if (!page.take()) {
+            continue;
+        }
+        if (!budget.add_result()) {
+            break;
+        }
+        page_results.push_back(std::move(match));
+    }
+    return page_results;
+}
+
+} // namespace speller
@@ -1,43 +1,62 @@
 #include <speller/locale.hpp>
 ////////////////////////////////////////////////////////////////////////////////
 // Standard Headers
+#include <mutex>
+#include <shared_mutex>
 #include <stdexcept>
 #include <string>
 #include <tuple>
-#include <vector>
 ////////////////////////////////////////////////////////////////////////////////
 // User defined Headers
 #include <speller/alphabet.hpp>
+#include <speller/builtin_alphabets.hpp>
 ////////////////////////////////////////////////////////////////////////////////
 
 namespace speller {
 
-static Alphabet get_default_alphabet()
+// names of the locales whose alphabets are built from compile time tables
+static bool is_builtin_locale(const std::string& locale_name)
 {
-    std::vector<std::string> lowercase_letters;
-    for (char ch = 'a'; ch <= 'z'; ch++) {
-        lowercase_letters.emplace_back(std::string { ch });
-    }
-    std::vector<std::string> uppercase_letters;
-    for (char ch = 'A'; ch <= 'Z'; ch++) {
-        uppercase_letters.emplace_back(std::string { ch });
-    }
-    return Alphabet(std::move(lowercase_letters), std::move(uppercase_letters));
+    return locale_name == Locale::default_locale_name || locale_name == "tr";
+}
+
+static Alphabet get_builtin_alphabet(const std::string& locale_name)
+{
+    return (locale_name == "tr") ? alphabet_from_table(tr_letters) : alphabet_from_table(en_letters);
 }
 
-std::map<std::string, Alphabet> Locale::locales = { { default_locale_name, get_default_alphabet() } };
+// built-in locales are added on first use, rather than during static initialization
+std::map<std::string, Alphabet> Locale::locales;
+std::shared_mutex Locale::locales_mutex;
 
-Locale::Locale(std::string locale_name_value)
-    : locale_name(std::move(locale_name_value))
+Locale::Locale(std::string locale_name)
 {
-    // given locale must exist
-    if (locales.find(locale_name) == locales.end()) {
+    // look up under a shared lock, so that concurrent queries do not wait for each other
+    {
+        const std::shared_lock<std::shared_mutex> lock(locales_mutex);
+        const auto it = locales.find(locale_name);
+        if (it != locales.end()) {
+            // map nodes are stable, so the pointer outlives the lock
+            alphabet = &it->second;
+            return;
+        }
+    }
+    // given locale must exist, adding it first if it is built in
+    const std::lock_guard<std::shared_mutex> lock(locales_mutex);
+    const auto it = find_locale(locale_name);
+    if (it == locales.end()) {
         throw std::invalid_argument("Locale does not exist: " + locale_name);
     }
+    // map nodes are stable, so the pointer outlives the lock
+    alphabet = &it->second;
 }
 
 void Locale::add_locale(std::string locale_name, Alphabet alphabet_value)
 {
+    const std::lock_guard<std::shared_mutex> lock(locales_mutex);
+    if (is_builtin_locale(locale_name)) {
+        throw std::invalid_argument("Locale already exists: " + locale_name);
+    }
     bool inserted;
     std::tie(std::ignore, inserted) = locales.insert({ locale_name, std::move(alphabet_value) });
     if (!inserted) {
@@ -45,9 +64,46 @@ void Locale::add_locale(std::string locale_name, Alphabet alphabet_value)
     }
 }
 
+std::string Locale::add_unique_locale(const std::string& locale_name, Alphabet alphabet_value)
+{
+    const std::lock_guard<std::shared_mutex> lock(locales_mutex);
+    std::string unique_name = locale_name;
+    for (size_t i = 1; locales.count(unique_name) || is_builtin_locale(unique_name); i++) {
+        unique_name = locale_name + "#" + std::to_string(i);
+    }
+    locales.insert({ unique_name, std::move(alphabet_value) });
+    return unique_name;
+}
+
+void Locale::remove_locale(const std::string& locale_name)
+{
+    const std::lock_guard<std::shared_mutex> lock(locales_mutex);
+    if (is_builtin_locale(locale_name) || !locales.erase(locale_name)) {
+        throw std::invalid_argument("Locale was not added: " + locale_name);
+    }
+}
+
+bool Locale::has_locale(const std::string& locale_name)
+{
+    if (is_builtin_locale(locale_name)) {
+        return true;
+    }
+    const std::shared_lock<std::shared_mutex> lock(locales_mutex);
+    return locales.count(locale_name) != 0;
+}
+
 const Alphabet& Locale::get_alphabet() const& noexcept
 {
-    return locales.at(locale_name);
+    return *alphabet;
+}
+
+std::map<std::string, Alphabet>::const_iterator Locale::find_locale(const std::string& locale_name)
+{
+    auto it = locales.find(locale_name);
+    if (it == locales.end() && is_builtin_locale(locale_name)) {
+        it = locales.emplace(locale_name, get_builtin_alphabet(locale_name)).first;
+    }
+    return it;
 }
 
 } // namespace speller
@@ -0,0 +1,125 @@
+#include <speller/message_channel.hpp>
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+////////////////////////////////////////////////////////////////////////////////
+// System Headers
+#include <poll.h>
+#include <unistd.h>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+MessageChannel::MessageChannel(int fd) noexcept
+    : fd(fd)
+{
+}
+
+MessageChannel::MessageChannel(MessageChannel&& other) noexcept
+    : fd(other.fd)
+{
+    other.fd = -1;
+}
+
+MessageChannel& MessageChannel::operator=(MessageChannel&& other) noexcept
+{
+    if (this != &other) {
+        close();
+        fd = other.fd;
+        other.fd = -1;
+    }
+    return *this;
+}
+
+MessageChannel::~MessageChannel()
+{
+    close();
+}
+
+// write everything, retrying partial and interrupted writes
+static bool write_all(int fd, const char* data, size_t size)
+{
+    while (size != 0) {
+        const ssize_t written = ::write(fd, data, size);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        data += written;
+        size -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+// read exactly @a size characters before the deadline
+static bool read_all(int fd, char* data, size_t size, std::chrono::steady_clock::time_point deadline, bool has_deadline)
+{
+    while (size != 0) {
+        int poll_timeout = -1;
+        if (has_deadline) {
+            const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+            if (remaining.count() <= 0) {
+                return false;
+            }
+            poll_timeout = static_cast<int>(remaining.count());
+        }
+        pollfd descriptor { fd, POLLIN, 0 };
+        const int ready = ::poll(&descriptor, 1, poll_timeout);
+        if (ready < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ready <= 0) {
+            return false;
+        }
+        const ssize_t num_read = ::read(fd, data, size);
+        if (num_read < 0 && errno == EINTR) {
+            continue;
+        }
+        if (num_read <= 0) {
+            return false;
+        }
+        data += num_read;
+        size -= static_cast<size_t>(num_read);
+    }
+    return true;
+}
+
+bool MessageChannel::send(std::string_view message)
+{
+    const auto size = static_cast<std::uint64_t>(message.size());
+    return write_all(fd, reinterpret_cast<const char*>(&size), sizeof(size))
+        && write_all(fd, message.data(), message.size());
+}
+
+bool MessageChannel::receive(std::string& message, std::chrono::milliseconds timeout)
+{
+    const bool has_deadline = (timeout.count() > 0);
+    const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + timeout;
+    std::uint64_t size;
+    if (!read_all(fd, reinterpret_cast<char*>(&size), sizeof(size), deadline, has_deadline)) {
+        return false;
+    }
+    message.resize(static_cast<size_t>(size));
+    return read_all(fd, message.data(), message.size(), deadline, has_deadline);
+}
+
+int MessageChannel::get_fd() const noexcept
+{
+    return fd;
+}
+
+void MessageChannel::close() noexcept
+{
+    if (fd >= 0) {
+        ::close(fd);
+        fd = -1;
+    }
+}
+
+} // namespace speller
@@ -0,0 +1,257 @@
+#include <speller/phrase_index.hpp>
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <algorithm>
+#include <charconv>
+#include <iterator>
+#include <regex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Headers
+#include <speller/alphabet.hpp>
+#include <speller/locale.hpp>
+#include <speller/search.hpp>
+#include <speller/word.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+template <typename T>
+static T parse_number(std::string_view sw, const std::string& query)
+{
+    T value {};
+    const auto [end, ec] = std::from_chars(sw.data(), sw.data() + sw.size(), value);
+    if (ec != std::errc() || end != sw.data() + sw.size()) {
+        throw std::invalid_argument("Invalid number " + std::string(sw) + " in query: " + query);
+    }
+    return value;
+}
+
+PhraseQuery parse_phrase_query(const std::string& query)
+{
+    PhraseQuery result;
+    std::string_view remaining = query;
+    while (true) {
+        const size_t comma_pos = remaining.find(',');
+        const std::string_view term = remaining.substr(0, comma_pos);
+        if (term.empty()) {
+            throw std::invalid_argument("Empty term in query: " + query);
+        }
+        if (term.front() == '#') {
+            // number of words, optionally a minimum
+            const bool is_minimum = (term.back() == '+');
+            const size_t count = parse_number<size_t>(term.substr(1, term.size() - 1 - is_minimum), query);
+            if (count == 0) {
+                throw std::invalid_argument("Number of words must be positive in query: " + query);
+            }
+            result.min_num_words = std::max(result.min_num_words, count);
+            if (!is_minimum) {
+                result.max_num_words = std::min(result.max_num_words, count);
+            }
+        } else {
+            // word pattern, optionally at a position
+            PhraseWordFilter filter;
+            const size_t colon_pos = term.find(':');
+            if (colon_pos != std::string_view::npos) {
+                filter.position = parse_number<std::ptrdiff_t>(term.substr(0, colon_pos), query);
+                if (filter.position == PhraseWordFilter::any_position) {
+                    throw std::invalid_argument("Word positions start from 1 in query: " + query);
+                }
+            }
+            filter.pattern = term.substr(colon_pos == std::string_view::npos ? 0 : colon_pos + 1);
+            if (filter.pattern.empty()) {
+                throw std::invalid_argument("Empty word pattern in query: " + query);
+            }
+            result.word_filters.push_back(std::move(filter));
+        }
+        if (comma_pos == std::string_view::npos) {
+            break;
+        }
+        remaining.remove_prefix(comma_pos + 1);
+    }
+    return result;
+}
+
+PhraseIndex::PhraseIndex(const EntryStore& store, const std::string& locale_name)
+    : locale_name(locale_name)
+{
+    const Locale locale(locale_name);
+    const Alphabet& alphabet = locale.get_alphabet();
+    const EntryStore lowercase_store = to_lowercase(store, locale_name);
+
+    // collect postings of each word in the order words are encountered
+    std::unordered_map<std::string, size_t> word_ids;
+    std::vector<std::vector<Posting>> word_postings;
+    num_words.reserve(store.size());
+    for (size_t id = 0; id < lowercase_store.size(); id++) {
+        const Word entry(std::string(lowercase_store[id]), locale_name);
+        const std::string& entry_str = entry;
+        size_t position = 0;
+        size_t begin = 0;
+        size_t end = 0;
+        // word boundaries are found letter by letter, so that a space is never a part of a letter
+        for (size_t i = 0; i <= entry.length(); i++) {
+            const bool is_space = (i == entry.length()) || alphabet.classify(entry[i]) == Alphabet::LetterClass::space;
+            if (!is_space) {
+                end += entry[i].string_view().size();
+                continue;
+            }
+            if (end != begin) {
+                const auto [it, inserted] = word_ids.try_emplace(entry_str.substr(begin, end - begin), word_postings.size());
+                if (inserted) {
+                    word_postings.emplace_back();
+                }
+                word_postings[it->second].push_back({ id, position++ });
+            }
+            if (i != entry.length()) {
+                end += entry[i].string_view().size();
+            }
+            begin = end;
+        }
+        num_words.push_back(position);
+    }
+
+    // sort words, so that a literal prefix narrows down the words to test
+    std::vector<std::pair<std::string, size_t>> sorted_words(
+        std::make_move_iterator(word_ids.begin()), std::make_move_iterator(word_ids.end()));
+    word_ids.clear();
+    std::sort(sorted_words.begin(), sorted_words.end());
+    words.reserve(sorted_words.size());
+    posting_offsets.reserve(sorted_words.size() + 1);
+    posting_offsets.push_back(0);
+    for (auto& [word, word_id] : sorted_words) {
+        words.push_back(std::move(word));
+        std::vector<Posting>& word_posting = word_postings[word_id];
+        postings.insert(postings.end(), word_posting.begin(), word_posting.end());
+        posting_offsets.push_back(postings.size());
+        std::vector<Posting>().swap(word_posting);
+    }
+}
+
+std::vector<size_t> PhraseIndex::find_entries(const PhraseWordFilter& filter, QueryBudget& budget) const
+{
+    auto is_at_position = [this, &filter](const Posting& posting) {
+        if (filter.position == PhraseWordFilter::any_position) {
+            return true;
+        }
+        if (filter.position > 0) {
+            return posting.position == static_cast<size_t>(filter.position - 1);
+        }
+        const size_t num_entry_words = num_words[posting.entry_id];
+        const size_t position_from_end = static_cast<size_t>(-filter.position);
+        return position_from_end <= num_entry_words && posting.position == num_entry_words - position_from_end;
+    };
+
+    // words that start with the literal prefix of the pattern
+    const std::string lowercase_pattern = to_lowercase(std::string_view(filter.pattern), locale_name);
+    const std::string_view prefix = get_literal_prefix(lowercase_pattern);
+    const bool is_literal = (prefix.size() == lowercase_pattern.size());
+    const auto first = std::lower_bound(words.begin(), words.end(), prefix,
+        [](const std::string& word, std::string_view sw) { return word < sw; });
+    const std::regex rgx = is_literal ? std::regex() : wildcard_to_regex(filter.pattern, locale_name);
+
+    std::vector<size_t> results;
+    for (auto it = first; it != words.end() && it->compare(0, prefix.size(), prefix) == 0; ++it) {
+        if (is_literal && *it != prefix) {
+            break;
+        }
+        if (!is_literal) {
+            if (!budget.visit_expensive_candidate()) {
+                return results;
+            }
+            if (!std::regex_match(*it, rgx)) {
+                continue;
+            }
+        }
+        const size_t word_id = it - words.begin();
+        for (size_t i = posting_offsets[word_id]; i < posting_offsets[word_id + 1]; i++) {
+            if (!budget.visit_candidates()) {
+                return results;
+            }
+            if (is_at_position(postings[i])) {
+                results.push_back(postings[i].entry_id);
+            }
+        }
+    }
+    // an entry can contain several matching words
+    std::sort(results.begin(), results.end());
+    results.erase(std::unique(results.begin(), results.end()), results.end());
+    return results;
+}
+
+std::vector<size_t> PhraseIndex::find(const PhraseQuery& query, QueryBudget& budget, ResultPage& page) const
+{
+    // intersect entries that satisfy each word filter
+    std::vector<size_t> candidates;
+    for (size_t i = 0; i < query.word_filters.size(); i++) {
+        std::vector<size_t> filter_candidates = find_entries(query.word_filters[i], budget);
+        if (i == 0) {
+            candidates = std::move(filter_candidates);
+        } else {
+            std::vector<size_t> intersection;
+            std::set_intersection(candidates.begin(), candidates.end(),
+                filter_candidates.begin(), filter_candidates.end(), std::back_inserter(intersection));
+            candidates = std::move(intersection);
+        }
+        // entries found before the budget ran out satisfy every filter only if no filter is left
+        if (budget.is_truncated()) {
+            if (i + 1 != query.word_filters.size()) {
+                candidates.clear();
+            }
+            break;
+        }
+        if (candidates.empty()) {
+            break;
+        }
+    }
+
+    // check the number of words, examining every entry if there is no word filter,
+    // and without accounting for the entries found before the budget ran out
+    const bool is_truncated = budget.is_truncated();
+    const bool has_word_filters = !query.word_filters.empty();
+    const size_t num_candidates = has_word_filters ? candidates.size() : num_words.size();
+    std::vector<size_t> results;
+    for (size_t i = 0; i < num_candidates; i++) {
+        if (page.is_complete()) {
+            page.stop();
+            break;
+        }
+        if (!is_truncated && !budget.visit_candidates()) {
+            break;
+        }
+        const size_t id = has_word_filters ? candidates[i] : i;
+        if (num_words[id] < query.min_num_words || num_words[id] > query.max_num_words) {
+            continue;
+        }
+        if (!page.take()) {
+            continue;
+        }
+        if (!budget.add_result()) {
+            break;
+        }
+        results.push_back(id);
+    }
+    return results;
+}
+
+size_t PhraseIndex::get_num_words(size_t entry_id) const&
+{
+    return num_words.at(entry_id);
+}
+
+size_t PhraseIndex::get_num_distinct_words() const noexcept
+{
+    return words.size();
+}
+
+const std::string& PhraseIndex::get_locale_name() const& noexcept
+{
+    return locale_name;
+}
+
+} // namespace speller
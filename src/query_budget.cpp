@@ -0,0 +1,105 @@
+#include <speller/query_budget.hpp>
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <chrono>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+// reading the clock for every candidate would dominate cheap scans
+static constexpr size_t candidates_per_clock_check = 1024;
+
+QueryBudget::QueryBudget() noexcept
+    : QueryBudget(QueryLimits())
+{
+}
+
+QueryBudget::QueryBudget(const QueryLimits& limits_value) noexcept
+    : limits(limits_value)
+    , deadline(clock::now() + limits_value.timeout)
+{
+}
+
+bool QueryBudget::visit_candidates(size_t count) noexcept
+{
+    if (truncation != Truncation::none) {
+        return false;
+    }
+    if (cancelled.load(std::memory_order_relaxed)) {
+        return truncate(Truncation::cancelled);
+    }
+    if (limits.max_candidates - num_candidates < count) {
+        num_candidates = limits.max_candidates;
+        return truncate(Truncation::max_candidates);
+    }
+    num_candidates += count;
+    if (limits.timeout.count() > 0 && num_candidates >= next_clock_check) {
+        next_clock_check = num_candidates + candidates_per_clock_check;
+        if (clock::now() >= deadline) {
+            return truncate(Truncation::timeout);
+        }
+    }
+    return true;
+}
+
+bool QueryBudget::visit_expensive_candidate() noexcept
+{
+    // the next call reads the clock
+    next_clock_check = num_candidates;
+    return visit_candidates();
+}
+
+bool QueryBudget::add_result() noexcept
+{
+    if (num_results >= limits.max_results) {
+        // keep the reason that stopped examining candidates
+        return (truncation == Truncation::none) ? truncate(Truncation::max_results) : false;
+    }
+    num_results++;
+    return true;
+}
+
+void QueryBudget::cancel() noexcept
+{
+    cancelled.store(true, std::memory_order_relaxed);
+}
+
+size_t QueryBudget::get_num_candidates() const noexcept
+{
+    return num_candidates;
+}
+
+bool QueryBudget::is_truncated() const noexcept
+{
+    return truncation != Truncation::none;
+}
+
+QueryBudget::Truncation QueryBudget::get_truncation() const noexcept
+{
+    return truncation;
+}
+
+const char* QueryBudget::get_truncation_reason() const noexcept
+{
+    switch (truncation) {
+    case Truncation::none:
+        return "none";
+    case Truncation::timeout:
+        return "time limit exceeded";
+    case Truncation::max_candidates:
+        return "maximum number of candidates examined";
+    case Truncation::max_results:
+        return "maximum number of results found";
+    case Truncation::cancelled:
+        return "cancelled";
+    }
+    return "unknown";
+}
+
+bool QueryBudget::truncate(Truncation reason) noexcept
+{
+    truncation = reason;
+    return false;
+}
+
+} // namespace speller
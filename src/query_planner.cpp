@@ -0,0 +1,341 @@
+#include <speller/query_planner.hpp>
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Headers
+#include <speller/alphabet.hpp>
+#include <speller/locale.hpp>
+#include <speller/search.hpp>
+#include <speller/word.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+// characters of a wildcard pattern that are interpreted as regex, other than wildcards
+static constexpr std::string_view regex_special_characters = R"(\^$.|+()[]{})";
+
+// costs relative to testing a candidate against the query
+static constexpr double key_id_cost = 1.0 / 16;
+static constexpr double mask_test_cost = 1.0 / 32;
+static constexpr double column_test_cost = 1.0 / 32;
+
+static constexpr LetterMask any_letter_mask = ~LetterMask(0);
+
+// identifier of the only letter of the mask, or foreign_letter_id if it has none or several
+static LetterId get_single_letter(LetterMask mask) noexcept
+{
+    if (mask == 0 || (mask & (mask - 1)) != 0) {
+        return Alphabet::foreign_letter_id;
+    }
+    LetterId id = 0;
+    for (; (mask & 1) == 0; mask >>= 1) {
+        id++;
+    }
+    return id;
+}
+
+// letters of lowercase text that fit in a mask
+static LetterMask get_letters_mask(const Word& word, const Alphabet& alphabet)
+{
+    LetterMask mask = 0;
+    for (size_t i = 0; i < word.length(); i++) {
+        const LetterId id = alphabet.get_letter_id(word[i]);
+        if (id != Alphabet::foreign_letter_id && id < std::numeric_limits<LetterMask>::digits) {
+            mask |= LetterMask(1) << id;
+        }
+    }
+    return mask;
+}
+
+LetterMask QueryShape::get_required_letters_mask() const noexcept
+{
+    LetterMask mask = 0;
+    for (size_t id = 0; id < required_letter_counts.size() && id < std::numeric_limits<LetterMask>::digits; id++) {
+        if (required_letter_counts[id] != 0) {
+            mask |= LetterMask(1) << id;
+        }
+    }
+    return mask;
+}
+
+QueryShape shape_from_wildcard(const std::string& pattern, const std::string& locale_name)
+{
+    const Locale locale(locale_name);
+    const Alphabet& alphabet = locale.get_alphabet();
+    const std::string lowercase_pattern = to_lowercase(std::string_view(pattern), locale_name);
+
+    QueryShape shape;
+    shape.anchored_prefix = get_literal_prefix(lowercase_pattern);
+    shape.anchored_suffix = get_literal_suffix(lowercase_pattern);
+    shape.is_exact = (shape.anchored_prefix.size() == lowercase_pattern.size());
+    shape.required_letter_counts.resize(alphabet.size());
+
+    // wildcards match a single code point, which is a letter unless letters consist of several characters
+    if (alphabet.get_encoding() == Alphabet::Encoding::generic
+        || lowercase_pattern.find_first_of(regex_special_characters) != std::string::npos) {
+        return shape;
+    }
+    size_t num_letters = 0;
+    bool has_asterisk = false;
+    size_t literal_begin = 0;
+    for (size_t i = 0; i <= lowercase_pattern.size(); i++) {
+        if (i != lowercase_pattern.size() && lowercase_pattern[i] != '*' && lowercase_pattern[i] != '?') {
+            continue;
+        }
+        const Word literal(lowercase_pattern.substr(literal_begin, i - literal_begin), locale_name);
+        for (size_t j = 0; j < literal.length(); j++) {
+            const LetterId id = alphabet.get_letter_id(literal[j]);
+            if (id != Alphabet::foreign_letter_id) {
+                shape.required_letter_counts[id]++;
+            }
+        }
+        num_letters += literal.length();
+        if (i != lowercase_pattern.size()) {
+            num_letters++;
+            has_asterisk |= (lowercase_pattern[i] == '*');
+        }
+        literal_begin = i + 1;
+    }
+    shape.min_length = num_letters;
+    shape.max_length = has_asterisk ? QueryShape::unlimited : num_letters;
+    return shape;
+}
+
+QueryShape shape_from_anagram(const std::string& query, const std::string& locale_name)
+{
+    const Locale locale(locale_name);
+    const Alphabet& alphabet = locale.get_alphabet();
+    // jokers are not in the alphabet
+    const Word word = Word(query, locale_name).tolower();
+
+    QueryShape shape;
+    shape.min_length = word.length();
+    shape.max_length = word.length();
+    shape.required_letter_counts.resize(alphabet.size());
+    for (size_t i = 0; i < word.length(); i++) {
+        const LetterId id = alphabet.get_letter_id(word[i]);
+        if (id != Alphabet::foreign_letter_id) {
+            shape.required_letter_counts[id]++;
+        }
+    }
+    return shape;
+}
+
+QueryShape shape_from_letter_set(const LetterSetQuery& query, const std::string& locale_name)
+{
+    const Locale locale(locale_name);
+    const Alphabet& alphabet = locale.get_alphabet();
+    const LetterMask all_letters = (alphabet.size() >= std::numeric_limits<LetterMask>::digits)
+        ? any_letter_mask
+        : (LetterMask(1) << alphabet.size()) - 1;
+
+    QueryShape shape;
+    shape.min_length = query.position_masks.size();
+    shape.max_length = query.position_masks.size();
+    shape.required_letter_counts = query.required_letter_counts;
+    shape.required_letter_counts.resize(alphabet.size());
+
+    // a position of a single letter requires it, and anchors the word where it is not preceded by other positions
+    std::vector<size_t> fixed_counts(alphabet.size());
+    std::vector<LetterId> fixed_ids;
+    for (LetterMask mask : query.position_masks) {
+        mask &= all_letters;
+        shape.position_masks.push_back((mask == all_letters) ? any_letter_mask : mask);
+        const LetterId id = get_single_letter(mask);
+        fixed_ids.push_back(id);
+        if (id != Alphabet::foreign_letter_id) {
+            fixed_counts[id]++;
+        }
+    }
+    for (size_t id = 0; id < alphabet.size(); id++) {
+        shape.required_letter_counts[id] = std::max(shape.required_letter_counts[id], fixed_counts[id]);
+    }
+    const auto prefix_end = std::find(fixed_ids.begin(), fixed_ids.end(), Alphabet::foreign_letter_id);
+    for (auto it = fixed_ids.begin(); it != prefix_end; ++it) {
+        shape.anchored_prefix += alphabet.get_lowercase_letter(*it).string_view();
+    }
+    const auto suffix_begin = std::find(fixed_ids.rbegin(), fixed_ids.rend(), Alphabet::foreign_letter_id).base();
+    for (auto it = std::max(suffix_begin, prefix_end); it != fixed_ids.end(); ++it) {
+        shape.anchored_suffix += alphabet.get_lowercase_letter(*it).string_view();
+    }
+    return shape;
+}
+
+QueryPlan plan_query(QueryShape shape, const PlanningIndexes& indexes, const std::string& locale_name)
+{
+    const double num_entries = static_cast<double>(indexes.num_entries);
+    QueryPlan best;
+    best.access_paths = { AccessPath::full_scan };
+    best.estimated_candidates = num_entries;
+    best.estimated_cost = num_entries;
+
+    // a key is looked up at once, which counts as a single candidate
+    if (shape.is_exact && indexes.key_index) {
+        best.access_paths = { AccessPath::exact_key };
+        best.estimated_candidates = 1;
+        best.estimated_cost = 1;
+        best.shape = std::move(shape);
+        return best;
+    }
+
+    // columns are tested where a letter is constrained
+    if (indexes.letter_matrix && shape.min_length == shape.max_length) {
+        const auto num_constrained = static_cast<double>(std::count_if(shape.position_masks.begin(), shape.position_masks.end(),
+            [](LetterMask mask) { return mask != any_letter_mask; }));
+        const double candidates = static_cast<double>(indexes.letter_matrix->count_words(shape.min_length)) * std::max(num_constrained, 1.0);
+        if (candidates * column_test_cost < best.estimated_cost) {
+            best.access_paths = { AccessPath::letter_matrix };
+            best.estimated_candidates = candidates;
+            best.estimated_cost = candidates * column_test_cost;
+        }
+    }
+
+    // access paths that narrow down the candidates, with the number of entries each produces and the cost of reading them
+    struct Range {
+        AccessPath access_path;
+        double size;
+        double read_cost;
+    };
+    std::vector<Range> ranges;
+    if (!shape.anchored_prefix.empty() && indexes.key_index) {
+        const auto size = static_cast<double>(indexes.key_index->count_prefix(shape.anchored_prefix));
+        ranges.push_back({ AccessPath::key_prefix, size, size * key_id_cost });
+    }
+    if (!shape.anchored_suffix.empty() && indexes.suffix_index) {
+        const auto size = static_cast<double>(indexes.suffix_index->count_prefix(reverse_letters(shape.anchored_suffix, locale_name)));
+        ranges.push_back({ AccessPath::key_suffix, size, size * key_id_cost });
+    }
+    const LetterMask required_mask = shape.get_required_letters_mask();
+    double num_in_length = 0;
+    if (indexes.statistics && (shape.min_length != 0 || shape.max_length != QueryShape::unlimited || required_mask != 0)) {
+        num_in_length = static_cast<double>(indexes.statistics->count_length(shape.min_length, shape.max_length));
+        double size = num_in_length;
+        for (size_t id = 0; id < std::numeric_limits<LetterMask>::digits; id++) {
+            if ((required_mask >> id) & 1) {
+                size *= indexes.statistics->get_entry_frequency(static_cast<LetterId>(id));
+            }
+        }
+        ranges.push_back({ AccessPath::length_mask, size, num_in_length * mask_test_cost });
+    }
+
+    // fraction of the entries of the key ranges that the length and letters leave,
+    // which is not narrowed down by the letters and the length that the anchored text already implies
+    const Locale locale(locale_name);
+    const Alphabet& alphabet = locale.get_alphabet();
+    const Word prefix(shape.anchored_prefix, locale_name);
+    const Word suffix(shape.anchored_suffix, locale_name);
+    auto get_length_mask_fraction = [&](bool has_key_prefix, bool has_key_suffix) {
+        LetterMask covered_mask = 0;
+        size_t covered_length = 0;
+        if (has_key_prefix) {
+            covered_mask |= get_letters_mask(prefix, alphabet);
+            covered_length = std::max(covered_length, prefix.length());
+        }
+        if (has_key_suffix) {
+            covered_mask |= get_letters_mask(suffix, alphabet);
+            covered_length = std::max(covered_length, suffix.length());
+        }
+        const bool is_length_covered = (shape.max_length == QueryShape::unlimited && shape.min_length <= covered_length);
+        double fraction = (is_length_covered || num_entries == 0) ? 1 : num_in_length / num_entries;
+        for (size_t id = 0; id < std::numeric_limits<LetterMask>::digits; id++) {
+            if (((required_mask & ~covered_mask) >> id) & 1) {
+                fraction *= indexes.statistics->get_entry_frequency(static_cast<LetterId>(id));
+            }
+        }
+        return fraction;
+    };
+
+    // intersect every combination of ranges
+    std::sort(ranges.begin(), ranges.end(), [](const Range& lhs, const Range& rhs) { return lhs.size < rhs.size; });
+    for (size_t subset = 1; subset < (size_t(1) << ranges.size()); subset++) {
+        bool has_key_prefix = false;
+        bool has_key_suffix = false;
+        for (size_t i = 0; i < ranges.size(); i++) {
+            if ((subset >> i) & 1) {
+                has_key_prefix |= (ranges[i].access_path == AccessPath::key_prefix);
+                has_key_suffix |= (ranges[i].access_path == AccessPath::key_suffix);
+            }
+        }
+        std::vector<AccessPath> access_paths;
+        double candidates = num_entries;
+        double cost = 0;
+        for (size_t i = 0; i < ranges.size(); i++) {
+            if ((subset >> i) & 1) {
+                access_paths.push_back(ranges[i].access_path);
+                if (ranges[i].access_path == AccessPath::length_mask) {
+                    candidates *= get_length_mask_fraction(has_key_prefix, has_key_suffix);
+                } else {
+                    candidates *= (num_entries != 0) ? ranges[i].size / num_entries : 0;
+                }
+                cost += ranges[i].read_cost;
+            }
+        }
+        cost += candidates;
+        if (cost < best.estimated_cost) {
+            best.access_paths = std::move(access_paths);
+            best.estimated_candidates = candidates;
+            best.estimated_cost = cost;
+        }
+    }
+    best.shape = std::move(shape);
+    return best;
+}
+
+std::string describe_plan(const QueryPlan& plan, const std::string& locale_name)
+{
+    const Locale locale(locale_name);
+    const Alphabet& alphabet = locale.get_alphabet();
+    const QueryShape& shape = plan.shape;
+    std::string result;
+    for (AccessPath access_path : plan.access_paths) {
+        if (!result.empty()) {
+            result += " & ";
+        }
+        switch (access_path) {
+        case AccessPath::full_scan:
+            result += "full scan";
+            break;
+        case AccessPath::exact_key:
+            result += "exact key \"" + shape.anchored_prefix + "\"";
+            break;
+        case AccessPath::key_prefix:
+            result += "key prefix \"" + shape.anchored_prefix + "\"";
+            break;
+        case AccessPath::key_suffix:
+            result += "key suffix \"" + shape.anchored_suffix + "\"";
+            break;
+        case AccessPath::length_mask: {
+            if (shape.max_length == QueryShape::unlimited) {
+                result += "length " + std::to_string(shape.min_length) + "+";
+            } else if (shape.min_length == shape.max_length) {
+                result += "length " + std::to_string(shape.min_length);
+            } else {
+                result += "length " + std::to_string(shape.min_length) + "-" + std::to_string(shape.max_length);
+            }
+            std::string letters;
+            const LetterMask required_mask = shape.get_required_letters_mask();
+            for (size_t id = 0; id < alphabet.size() && id < std::numeric_limits<LetterMask>::digits; id++) {
+                if ((required_mask >> id) & 1) {
+                    letters += alphabet.get_lowercase_letter(static_cast<LetterId>(id)).string_view();
+                }
+            }
+            if (!letters.empty()) {
+                result += " with letters \"" + letters + "\"";
+            }
+            break;
+        }
+        case AccessPath::letter_matrix:
+            result += "letter matrix of length " + std::to_string(shape.min_length);
+            break;
+        }
+    }
+    return result;
+}
+
+} // namespace speller
@@ -1,48 +1,100 @@
 ////////////////////////////////////////////////////////////////////////////////
 // Standard Headers
+#include <chrono>
 #include <cstdlib>
 #include <exception>
+#include <filesystem>
 #include <iostream>
+#include <memory>
 #include <regex>
 #include <string>
 #include <vector>
 ////////////////////////////////////////////////////////////////////////////////
 // User Defined Headers
+#include <speller/dictionary.hpp>
+#include <speller/dictionary_snapshot.hpp>
+#include <speller/live_snapshot.hpp>
+#include <speller/query_budget.hpp>
+#include <speller/result_page.hpp>
+#include <speller/search.hpp>
 #include <speller/utility.hpp>
 ////////////////////////////////////////////////////////////////////////////////
 
 int main(int argc, char** argv)
 try {
+    // Split command line arguments
+    const util::Arguments arguments = util::parse_arguments(argc, argv);
+    const std::vector<std::string>& positional = arguments.positional;
+
     // Obtain speller resource file path
-    const std::string speller_filename = (argc > 1) ? argv[1] : "tr.txt";
-    std::cout << "Speller filename: " << speller_filename << "\n";
+    speller::DictionaryFiles files;
+    files.speller_path = (positional.size() > 0) ? positional[0] : "tr.txt";
+    std::cout << "Speller filename: " << files.speller_path.string() << "\n";
     std::cout << std::endl;
 
-    // Read speller content
-    const std::string speller = util::file_to_string(speller_filename);
+    // Obtain query limits
+    speller::QueryLimits limits;
+    limits.timeout = std::chrono::milliseconds(util::get_option(arguments, "timeout-ms", limits.timeout.count()));
+    limits.max_candidates = util::get_option(arguments, "max-candidates", limits.max_candidates);
+    limits.max_results = util::get_option(arguments, "max-results", limits.max_results);
+
+    // Obtain result page
+    const size_t offset = util::get_option(arguments, "offset", size_t(0));
+    const size_t limit = util::get_option(arguments, "limit", speller::ResultPage::unlimited);
+    const bool count_only = util::has_option(arguments, "count-only");
+
+    // Watch resource files, if requested
+    const std::vector<std::filesystem::path> watched_paths = util::has_option(arguments, "watch") ? files.get_paths() : std::vector<std::filesystem::path>();
+
+    // Load resources
+    const speller::LiveSnapshot<speller::DictionarySnapshot> live(speller::dictionary_snapshot_loader(files), watched_paths);
 
     // Configure standard input
     util::enable_exceptions(std::cin);
     std::cin.tie(&std::cout);
 
+    // Configure standard output for matches
+    util::OutputBuffer output;
+
     // Run in an infinite loop
+    size_t snapshot_version = 0;
+    size_t num_failures = 0;
     while (true) {
+        // Report background reloads
+        if (live.get_version() != snapshot_version) {
+            snapshot_version = live.get_version();
+            std::cout << "Resources reloaded.\n";
+        }
+        if (live.get_num_failures() != num_failures) {
+            num_failures = live.get_num_failures();
+            std::cout << "Reload failed, using previous resources: " << live.get_last_error() << "\n";
+        }
+
         // Obtain regex to search in speller
         std::cout << "Search: ";
         std::string search_str;
         std::cin >> search_str;
 
-        // Obtain matches
-        static const std::string match_word_str = R"([^\r\n\t\f\v]*)";
-        const std::regex rgx(match_word_str + search_str + match_word_str);
-        const std::vector<std::string> results = util::get_all_matches(speller, rgx);
+        // Use the same snapshot for the whole query
+        const std::shared_ptr<const speller::DictionarySnapshot> snapshot = live.get();
+
+        // Obtain matches line by line, so that the budget is checked in between
+        const std::regex rgx = speller::compile_regex(search_str);
+        speller::QueryBudget budget(limits);
+        speller::ResultPage page(offset, limit, count_only);
+        const std::vector<speller::EntryHandle> results = snapshot->dictionary.search_regex(rgx, budget, page);
 
         // Print matches
-        std::cout << "A total of " << results.size() << " matches found.\n";
-        for (const std::string& res : results) {
-            std::cout << res << "\n";
+        const char* const lower_bound_str = (page.is_num_matches_exact() && !budget.is_truncated()) ? "" : "at least ";
+        output << "A total of " << lower_bound_str << page.get_num_matches() << " matches found.\n";
+        if (budget.is_truncated()) {
+            output << "Search truncated: " << budget.get_truncation_reason() << ".\n";
+        }
+        for (const speller::EntryHandle& res : results) {
+            output << res.text << '\n';
         }
-        std::cout << std::endl;
+        output << '\n';
+        output.flush();
     }
 } catch (const std::exception& e) {
     // Print error and exit
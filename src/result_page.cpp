@@ -0,0 +1,59 @@
+#include <speller/result_page.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+ResultPage::ResultPage() noexcept
+    : ResultPage(0, unlimited)
+{
+}
+
+ResultPage::ResultPage(size_t offset_value, size_t limit_value, bool count_only_value) noexcept
+    : offset(offset_value)
+    , limit(limit_value)
+    , count_only(count_only_value)
+{
+}
+
+bool ResultPage::take() noexcept
+{
+    const size_t index = num_matches++;
+    return !count_only && index >= offset && index - offset < limit;
+}
+
+bool ResultPage::is_complete() const noexcept
+{
+    return !count_only && num_matches >= offset && num_matches - offset >= limit;
+}
+
+void ResultPage::stop() noexcept
+{
+    stopped = true;
+}
+
+size_t ResultPage::get_num_matches() const noexcept
+{
+    return num_matches;
+}
+
+bool ResultPage::is_num_matches_exact() const noexcept
+{
+    return !stopped;
+}
+
+size_t ResultPage::get_offset() const noexcept
+{
+    return offset;
+}
+
+size_t ResultPage::get_limit() const noexcept
+{
+    return limit;
+}
+
+bool ResultPage::is_count_only() const noexcept
+{
+    return count_only;
+}
+
+} // namespace speller
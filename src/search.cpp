@@ -0,0 +1,184 @@
+#include <speller/search.hpp>
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <regex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Headers
+#include <speller/letter.hpp>
+#include <speller/locale.hpp>
+#include <speller/word.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+// characters that are not matched literally in a wildcard pattern
+static constexpr std::string_view pattern_special_characters = R"(\^$.|?*+()[]{})";
+
+// whether a group that contains an unbounded quantifier is itself repeated without bound
+static bool has_nested_unbounded_quantifiers(std::string_view pattern)
+{
+    // whether each open group, and the whole pattern at the bottom, contains an unbounded quantifier
+    std::vector<bool> groups { false };
+    // whether the previous atom is a group that contains an unbounded quantifier
+    bool is_unbounded_group = false;
+    for (size_t i = 0; i < pattern.size(); i++) {
+        bool is_unbounded_quantifier = false;
+        switch (pattern[i]) {
+        case '\\':
+            i++;
+            break;
+        case '[':
+            // skip the character class, whose special characters are literal
+            for (i++; i < pattern.size() && pattern[i] != ']'; i++) {
+                i += (pattern[i] == '\\');
+            }
+            break;
+        case '(':
+            groups.push_back(false);
+            break;
+        case ')':
+            if (groups.size() > 1) {
+                const bool is_unbounded = groups.back();
+                groups.pop_back();
+                groups.back() = groups.back() || is_unbounded;
+                is_unbounded_group = is_unbounded;
+                continue;
+            }
+            break;
+        case '*':
+        case '+':
+            is_unbounded_quantifier = true;
+            break;
+        case '{': {
+            // only a repetition without maximum, e.g. {2,}, is unbounded
+            const size_t end = pattern.find('}', i);
+            if (end != std::string_view::npos) {
+                is_unbounded_quantifier = (pattern[end - 1] == ',');
+                i = end;
+            }
+            break;
+        }
+        default:
+            break;
+        }
+        if (is_unbounded_quantifier) {
+            if (is_unbounded_group) {
+                return true;
+            }
+            groups.back() = true;
+        }
+        is_unbounded_group = false;
+    }
+    return false;
+}
+
+template <typename Predicate>
+static std::vector<EntryHandle> scan_entries(const EntryStore& store, Predicate predicate, QueryBudget& budget, ResultPage& page)
+{
+    // entries are examined one by one, so that the budget is checked in between, including the clock as regex tests are expensive
+    std::vector<EntryHandle> results;
+    for (size_t id = 0; id < store.size(); id++) {
+        if (page.is_complete()) {
+            page.stop();
+            break;
+        }
+        if (!budget.visit_expensive_candidate()) {
+            break;
+        }
+        if (!predicate(store[id])) {
+            continue;
+        }
+        if (!page.take()) {
+            continue;
+        }
+        if (!budget.add_result()) {
+            break;
+        }
+        results.push_back(store.get_handle(id));
+    }
+    return results;
+}
+
+std::regex compile_regex(const std::string& pattern)
+{
+    if (has_nested_unbounded_quantifiers(pattern)) {
+        throw std::invalid_argument("Regex has nested unbounded quantifiers: " + pattern);
+    }
+    return std::regex(pattern);
+}
+
+std::vector<EntryHandle> search_regex(const EntryStore& store, const std::regex& rgx, QueryBudget& budget, ResultPage& page)
+{
+    auto predicate = [&rgx](std::string_view sw) { return std::regex_search(sw.begin(), sw.end(), rgx); };
+    return scan_entries(store, predicate, budget, page);
+}
+
+std::vector<EntryHandle> match_regex(const EntryStore& store, const std::regex& rgx, QueryBudget& budget, ResultPage& page)
+{
+    auto predicate = [&rgx](std::string_view sw) { return std::regex_match(sw.begin(), sw.end(), rgx); };
+    return scan_entries(store, predicate, budget, page);
+}
+
+std::regex wildcard_to_regex(const std::string& pattern, const std::string& locale_name)
+{
+    // convert to lowercase
+    const std::string lowercase_pattern = to_lowercase(std::string_view(pattern), locale_name);
+    // replace wildcards with letter groups
+    static const std::regex asterisk_rgx(R"(\*)");
+    static const std::regex question_rgx(R"(\?)");
+    const std::string lowercase_regex_str = Locale(locale_name).get_alphabet().get_lowercase_letter_regex_str();
+    const std::string lowercase_or_space_regex_str = "(" + lowercase_regex_str + "| )";
+    std::string regex_str = std::regex_replace(lowercase_pattern, question_rgx, lowercase_or_space_regex_str);
+    regex_str = std::regex_replace(regex_str, asterisk_rgx, lowercase_or_space_regex_str + "+");
+    return compile_regex(regex_str);
+}
+
+std::string_view get_literal_prefix(std::string_view pattern)
+{
+    // an alternative can start with anything
+    if (pattern.find('|') != std::string_view::npos) {
+        return std::string_view();
+    }
+    const size_t size = pattern.find_first_of(pattern_special_characters);
+    std::string_view prefix = pattern.substr(0, size);
+    // a bounded repetition can omit the last code point
+    if (size != std::string_view::npos && pattern[size] == '{') {
+        while (!prefix.empty() && get_utf8_sequence_size(prefix.back()) == 0) {
+            prefix.remove_suffix(1);
+        }
+        if (!prefix.empty()) {
+            prefix.remove_suffix(1);
+        }
+    }
+    return prefix;
+}
+
+std::string_view get_literal_suffix(std::string_view pattern)
+{
+    // an alternative can end with anything
+    if (pattern.find('|') != std::string_view::npos) {
+        return std::string_view();
+    }
+    const size_t special = pattern.find_last_of(pattern_special_characters);
+    if (special == std::string_view::npos) {
+        return pattern;
+    }
+    std::string_view suffix = pattern.substr(special + 1);
+    // an escaped code point can be a character class, e.g. `\d`
+    if (pattern[special] == '\\' && !suffix.empty()) {
+        suffix.remove_prefix(get_utf8_sequence_size(suffix.front()));
+    }
+    return suffix;
+}
+
+EntryStore to_lowercase(const EntryStore& store, const std::string& locale_name)
+{
+    // line feeds are kept as is, so identifiers do not change
+    return EntryStore(to_lowercase(std::string_view(store.get_content()), locale_name));
+}
+
+} // namespace speller
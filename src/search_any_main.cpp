@@ -1,169 +1,125 @@
 ////////////////////////////////////////////////////////////////////////////////
 // Standard Headers
 #include <algorithm>
+#include <chrono>
 #include <cstdlib>
 #include <exception>
 #include <filesystem>
-#include <functional>
 #include <iostream>
-#include <iterator>
-#include <set>
+#include <memory>
 #include <string>
-#include <string_view>
 #include <vector>
 ////////////////////////////////////////////////////////////////////////////////
 // User Defined Headers
-#include <speller/alphabet.hpp>
-#include <speller/locale.hpp>
+#include <speller/anagram_index.hpp>
+#include <speller/dictionary.hpp>
+#include <speller/dictionary_snapshot.hpp>
+#include <speller/live_snapshot.hpp>
+#include <speller/query_budget.hpp>
+#include <speller/query_planner.hpp>
+#include <speller/result_page.hpp>
 #include <speller/utility.hpp>
-#include <speller/word.hpp>
 ////////////////////////////////////////////////////////////////////////////////
 
-namespace {
-
-class WordInfo {
-public:
-    explicit WordInfo(const std::string& str, const std::string& locale_name)
-        : word_lowercase(speller::Word(str, locale_name).tolower())
-    {
-        for (size_t i = 0; i < word_lowercase.length(); i++) {
-            const size_t hash = std::hash<speller::Letter>()(word_lowercase.at(i));
-            hashes.emplace(hash);
-        }
-    }
-
-    size_t length() const noexcept
-    {
-        return word_lowercase.length();
-    }
-
-    const std::string& get_lowercase_str() const& noexcept
-    {
-        return word_lowercase;
-    }
-
-    std::multiset<size_t> get_hashes() const
-    {
-        return hashes;
-    }
-
-private:
-    speller::Word word_lowercase;
-    std::multiset<size_t> hashes;
-};
-
-struct ResultInfo {
-    std::string str;
-    std::vector<speller::Letter> joker_letters;
-};
-
-} // namespace
-
 int main(int argc, char** argv)
 try {
+    // Split command line arguments
+    const util::Arguments arguments = util::parse_arguments(argc, argv);
+    const std::vector<std::string>& positional = arguments.positional;
+
     // Obtain speller resource file path
-    const std::filesystem::path speller_path = (argc > 1) ? argv[1] : "tr.txt";
-    std::cout << "Speller filename: " << speller_path.string() << "\n";
+    speller::DictionaryFiles files;
+    files.speller_path = (positional.size() > 0) ? positional[0] : "tr.txt";
+    std::cout << "Speller filename: " << files.speller_path.string() << "\n";
 
     // Obtain alphabet resource file, if specified
-    std::string locale_name = speller::Locale::default_locale_name;
-    const bool has_alphabet = (argc > 2);
-    if (has_alphabet) {
+    if (positional.size() > 1) {
         // Print configuration
-        const std::string alphabet_filename = argv[2];
-        locale_name = (argc > 3) ? argv[3] : speller_path.stem().string();
-        std::cout << "Alphabet filename: " << alphabet_filename << "\n";
-        std::cout << "Locale: " << locale_name << std::endl;
-
-        // Add locale
-        speller::Alphabet alphabet = speller::alphabet_from_file(alphabet_filename);
-        speller::Locale::add_locale(locale_name, std::move(alphabet));
+        files.alphabet_path = positional[1];
+        files.locale_name = (positional.size() > 2) ? positional[2] : files.speller_path.stem().string();
+        std::cout << "Alphabet filename: " << files.alphabet_path.string() << "\n";
+        std::cout << "Locale: " << files.locale_name << std::endl;
     }
     std::cout << std::endl;
 
-    // Read speller content
-    const std::vector<std::string> speller_orig = util::file_to_vector(speller_path);
-    // Convert to lowercase and calculate hashes
-    std::vector<WordInfo> speller_infos;
-    speller_infos.reserve(speller_orig.size());
-    std::transform(speller_orig.begin(), speller_orig.end(),
-        std::back_inserter(speller_infos),
-        [locale_name](const std::string& str) { return WordInfo(str, locale_name); });
+    // Obtain query limits
+    speller::QueryLimits limits;
+    limits.timeout = std::chrono::milliseconds(util::get_option(arguments, "timeout-ms", limits.timeout.count()));
+    limits.max_candidates = util::get_option(arguments, "max-candidates", limits.max_candidates);
+    limits.max_results = util::get_option(arguments, "max-results", limits.max_results);
+
+    // Obtain result page
+    const size_t offset = util::get_option(arguments, "offset", size_t(0));
+    const size_t limit = util::get_option(arguments, "limit", speller::ResultPage::unlimited);
+    const bool count_only = util::has_option(arguments, "count-only");
+
+    // Describe the plan of each query, if requested
+    const bool explain = util::has_option(arguments, "explain");
+
+    // Watch resource files, if requested
+    const std::vector<std::filesystem::path> watched_paths = util::has_option(arguments, "watch") ? files.get_paths() : std::vector<std::filesystem::path>();
+
+    // Load resources, then convert to lowercase, calculate hashes and gather statistics
+    auto build_indexes = [](const speller::Dictionary& dictionary) {
+        dictionary.get_anagram_index();
+        dictionary.get_statistics();
+    };
+    const speller::LiveSnapshot<speller::DictionarySnapshot> live(speller::dictionary_snapshot_loader(files, build_indexes), watched_paths);
 
     // Configure standard input
     util::enable_exceptions(std::cin);
     std::cin.tie(&std::cout);
 
+    // Configure standard output for matches
+    util::OutputBuffer output;
+
     // Run in an infinite loop
+    size_t snapshot_version = 0;
+    size_t num_failures = 0;
     while (true) {
+        // Report background reloads
+        if (live.get_version() != snapshot_version) {
+            snapshot_version = live.get_version();
+            std::cout << "Resources reloaded.\n";
+        }
+        if (live.get_num_failures() != num_failures) {
+            num_failures = live.get_num_failures();
+            std::cout << "Reload failed, using previous resources: " << live.get_last_error() << "\n";
+        }
+
         // Obtain search string
         std::cout << "Search: ";
         std::string search_str;
         std::cin >> search_str;
 
-        // Analyze search string
-        const WordInfo search_info = WordInfo(search_str, locale_name);
-        // Obtain letters to match
-        const std::multiset<size_t> search_hashes = search_info.get_hashes();
+        // Use the same snapshot for the whole query
+        const std::shared_ptr<const speller::DictionarySnapshot> snapshot = live.get();
+
         // Count wild cards
         constexpr char joker_letter = '?';
         const size_t num_jokers = std::count(search_str.begin(), search_str.end(), joker_letter);
 
-        // Create locale object
-        const speller::Locale locale(locale_name);
-        // Create alphabet object
-        const speller::Alphabet& alphabet = locale.get_alphabet();
-
         // Search database
-        std::vector<ResultInfo> results;
-        for (const WordInfo& info : speller_infos) {
-            // Lengths must match
-            if (info.length() != search_info.length()) {
-                continue;
-            }
-
-            // Calculate number of common letters
-            const std::multiset<size_t> info_hashes = info.get_hashes();
-            std::multiset<size_t> common_hashes;
-            std::set_intersection(search_hashes.begin(), search_hashes.end(),
-                info_hashes.begin(), info_hashes.end(),
-                std::inserter(common_hashes, common_hashes.begin()));
-            const size_t common_letters = common_hashes.size();
-
-            // Check whether all letters match
-            if (common_letters + num_jokers != search_info.length()) {
-                continue;
-            }
-
-            // Find joker letters
-            std::multiset<size_t> joker_hashes;
-            std::set_difference(info_hashes.begin(), info_hashes.end(),
-                common_hashes.begin(), common_hashes.end(),
-                std::inserter(joker_hashes, joker_hashes.begin()));
-
-            // Add to results
-            ResultInfo result;
-            result.str = info.get_lowercase_str();
-            for (size_t hash : joker_hashes) {
-                speller::Letter letter = alphabet.get_letter_from_hash(hash);
-                result.joker_letters.push_back(letter);
-            }
-            results.emplace_back(std::move(result));
-        }
+        const speller::QueryPlan plan = explain ? snapshot->dictionary.plan_anagrams(search_str) : speller::QueryPlan();
+        speller::QueryBudget budget(limits);
+        speller::ResultPage page(offset, limit, count_only);
+        const std::vector<speller::AnagramMatch> results = snapshot->dictionary.find_anagrams(search_str, budget, page);
 
         // Print matches
-        std::cout << "A total of " << results.size() << " matches found.\n";
-        for (const ResultInfo& res : results) {
-            std::cout << res.str;
-            if (num_jokers != 0) {
-                std::cout << "\t";
-                std::transform(res.joker_letters.begin(), res.joker_letters.end(),
-                    std::ostream_iterator<std::string_view>(std::cout),
-                    std::mem_fn(&speller::Letter::string_view));
-            }
-            std::cout << "\n";
+        if (explain) {
+            output << "Plan: " << speller::describe_plan(plan, snapshot->dictionary.get_locale_name()) << "\n";
+            output << "Candidates: " << static_cast<size_t>(plan.estimated_candidates + 0.5) << " estimated, " << budget.get_num_candidates() << " actual.\n";
+        }
+        const char* const lower_bound_str = (page.is_num_matches_exact() && !budget.is_truncated()) ? "" : "at least ";
+        output << "A total of " << lower_bound_str << page.get_num_matches() << " matches found.\n";
+        if (budget.is_truncated()) {
+            output << "Search truncated: " << budget.get_truncation_reason() << ".\n";
+        }
+        for (const speller::AnagramMatch& res : results) {
+            output << snapshot->dictionary.format_anagram_match(res, num_jokers != 0) << '\n';
         }
-        std::cout << std::endl;
+        output << '\n';
+        output.flush();
     }
 } catch (const std::exception& e) {
     // Print error and exit
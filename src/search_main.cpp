@@ -1,80 +1,123 @@
 ////////////////////////////////////////////////////////////////////////////////
 // Standard Headers
+#include <chrono>
 #include <cstdlib>
 #include <exception>
 #include <filesystem>
 #include <iostream>
-#include <regex>
+#include <memory>
 #include <string>
 #include <vector>
 ////////////////////////////////////////////////////////////////////////////////
 // User Defined Headers
-#include <speller/alphabet.hpp>
-#include <speller/locale.hpp>
+#include <speller/dictionary.hpp>
+#include <speller/dictionary_snapshot.hpp>
+#include <speller/live_snapshot.hpp>
+#include <speller/query_budget.hpp>
+#include <speller/query_planner.hpp>
+#include <speller/result_page.hpp>
 #include <speller/utility.hpp>
 #include <speller/word.hpp>
 ////////////////////////////////////////////////////////////////////////////////
 
 int main(int argc, char** argv)
 try {
+    // Split command line arguments
+    const util::Arguments arguments = util::parse_arguments(argc, argv);
+    const std::vector<std::string>& positional = arguments.positional;
+
     // Obtain speller resource file path
-    const std::filesystem::path speller_path = (argc > 1) ? argv[1] : "tr.txt";
-    std::cout << "Speller filename: " << speller_path.string() << "\n";
+    speller::DictionaryFiles files;
+    files.speller_path = (positional.size() > 0) ? positional[0] : "tr.txt";
+    std::cout << "Speller filename: " << files.speller_path.string() << "\n";
 
     // Obtain alphabet resource file, if specified
-    std::string locale_name = speller::Locale::default_locale_name;
-    const bool has_alphabet = (argc > 2);
-    if (has_alphabet) {
+    if (positional.size() > 1) {
         // Print configuration
-        const std::string alphabet_filename = argv[2];
-        locale_name = (argc > 3) ? argv[3] : speller_path.stem().string();
-        std::cout << "Alphabet filename: " << alphabet_filename << "\n";
-        std::cout << "Locale: " << locale_name << std::endl;
-
-        // Add locale
-        speller::Alphabet alphabet = speller::alphabet_from_file(alphabet_filename);
-        speller::Locale::add_locale(locale_name, std::move(alphabet));
+        files.alphabet_path = positional[1];
+        files.locale_name = (positional.size() > 2) ? positional[2] : files.speller_path.stem().string();
+        std::cout << "Alphabet filename: " << files.alphabet_path.string() << "\n";
+        std::cout << "Locale: " << files.locale_name << std::endl;
     }
     std::cout << std::endl;
 
-    // Read speller content
-    const std::string speller_orig = util::file_to_string(speller_path);
-    // Convert to lowercase
-    const speller::Word speller_lower = speller::Word(speller_orig, locale_name).tolower();
+    // Obtain query limits
+    speller::QueryLimits limits;
+    limits.timeout = std::chrono::milliseconds(util::get_option(arguments, "timeout-ms", limits.timeout.count()));
+    limits.max_candidates = util::get_option(arguments, "max-candidates", limits.max_candidates);
+    limits.max_results = util::get_option(arguments, "max-results", limits.max_results);
+
+    // Obtain result page
+    const size_t offset = util::get_option(arguments, "offset", size_t(0));
+    const size_t limit = util::get_option(arguments, "limit", speller::ResultPage::unlimited);
+    const bool count_only = util::has_option(arguments, "count-only");
+
+    // Describe the plan of each query, if requested
+    const bool explain = util::has_option(arguments, "explain");
+
+    // Watch resource files, if requested
+    const std::vector<std::filesystem::path> watched_paths = util::has_option(arguments, "watch") ? files.get_paths() : std::vector<std::filesystem::path>();
+
+    // Load resources, then sort lowercase entries by their prefixes and suffixes and gather statistics
+    auto build_indexes = [](const speller::Dictionary& dictionary) {
+        dictionary.get_key_index();
+        if (dictionary.uses_suffix_index()) {
+            dictionary.get_suffix_index();
+        }
+        dictionary.get_statistics();
+    };
+    const speller::LiveSnapshot<speller::DictionarySnapshot> live(speller::dictionary_snapshot_loader(files, build_indexes), watched_paths);
 
     // Configure standard input
     util::enable_exceptions(std::cin);
     std::cin.tie(&std::cout);
 
+    // Configure standard output for matches
+    util::OutputBuffer output;
+
     // Run in an infinite loop
+    size_t snapshot_version = 0;
+    size_t num_failures = 0;
     while (true) {
+        // Report background reloads
+        if (live.get_version() != snapshot_version) {
+            snapshot_version = live.get_version();
+            std::cout << "Resources reloaded.\n";
+        }
+        if (live.get_num_failures() != num_failures) {
+            num_failures = live.get_num_failures();
+            std::cout << "Reload failed, using previous resources: " << live.get_last_error() << "\n";
+        }
+
         // Obtain search string
         std::cout << "Search: ";
         std::string search_str;
         std::cin >> search_str;
 
-        // Convert to lowercase
-        search_str = speller::Word(search_str, locale_name).tolower();
+        // Use the same snapshot for the whole query
+        const std::shared_ptr<const speller::DictionarySnapshot> snapshot = live.get();
 
-        // Create regex from search string
-        static const std::regex asterisk_rgx(R"(\*)");
-        static const std::regex question_rgx(R"(\?)");
-        const std::string lowercase_regex_str = speller::Locale(locale_name).get_alphabet().get_lowercase_letter_regex_str();
-        const std::string lowercase_or_space_regex_str = "(" + lowercase_regex_str + "| )";
-        std::string regex_str = std::regex_replace(search_str, question_rgx, lowercase_or_space_regex_str);
-        regex_str = std::regex_replace(regex_str, asterisk_rgx, lowercase_or_space_regex_str + "+");
-        regex_str = "^" + regex_str + "$";
-
-        // Obtain matches
-        const std::regex rgx(regex_str);
-        const std::vector<std::string> results = util::get_all_matches(speller_lower, rgx);
+        // Obtain matches line by line, so that the budget is checked in between
+        const speller::QueryPlan plan = explain ? snapshot->dictionary.plan_wildcard(search_str) : speller::QueryPlan();
+        speller::QueryBudget budget(limits);
+        speller::ResultPage page(offset, limit, count_only);
+        const std::vector<speller::EntryHandle> results = snapshot->dictionary.match_wildcard(search_str, budget, page);
 
         // Print matches
-        std::cout << "A total of " << results.size() << " matches found.\n";
-        for (const std::string& res : results) {
-            std::cout << res << "\n";
+        if (explain) {
+            output << "Plan: " << speller::describe_plan(plan, snapshot->dictionary.get_locale_name()) << "\n";
+            output << "Candidates: " << static_cast<size_t>(plan.estimated_candidates + 0.5) << " estimated, " << budget.get_num_candidates() << " actual.\n";
+        }
+        const char* const lower_bound_str = (page.is_num_matches_exact() && !budget.is_truncated()) ? "" : "at least ";
+        output << "A total of " << lower_bound_str << page.get_num_matches() << " matches found.\n";
+        if (budget.is_truncated()) {
+            output << "Search truncated: " << budget.get_truncation_reason() << ".\n";
+        }
+        for (const speller::EntryHandle& res : results) {
+            output << speller::to_lowercase(res.text, snapshot->dictionary.get_locale_name()) << '\n';
         }
-        std::cout << std::endl;
+        output << '\n';
+        output.flush();
     }
 } catch (const std::exception& e) {
     // Print error and exit
@@ -0,0 +1,286 @@
+#include <speller/shard.hpp>
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <regex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Headers
+#include <speller/anagram_index.hpp>
+#include <speller/entry_store.hpp>
+#include <speller/letter_matrix.hpp>
+#include <speller/result_page.hpp>
+#include <speller/search.hpp>
+#include <speller/word.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+ShardMode shard_mode_from_string(const std::string& name)
+{
+    if (name == "regex") {
+        return ShardMode::regex;
+    }
+    if (name == "search") {
+        return ShardMode::search;
+    }
+    if (name == "search_any") {
+        return ShardMode::search_any;
+    }
+    if (name == "letter_set") {
+        return ShardMode::letter_set;
+    }
+    throw std::invalid_argument("Unknown query mode: " + name);
+}
+
+ShardStrategy shard_strategy_from_string(const std::string& name)
+{
+    if (name == "hash") {
+        return ShardStrategy::hash;
+    }
+    if (name == "length") {
+        return ShardStrategy::length;
+    }
+    throw std::invalid_argument("Unknown shard strategy: " + name);
+}
+
+size_t ShardLayout::get_shard_index(std::string_view entry) const
+{
+    if (strategy == ShardStrategy::length) {
+        return Word(std::string(entry), locale_name).length() % num_shards;
+    }
+    // FNV-1a, so that every process agrees on the distribution
+    std::uint64_t hash = 0xCBF29CE484222325ull;
+    for (char ch : entry) {
+        hash = (hash ^ static_cast<unsigned char>(ch)) * 0x100000001B3ull;
+    }
+    return static_cast<size_t>(hash % num_shards);
+}
+
+size_t ShardLayout::get_query_shard_index(ShardMode mode, const std::string& query) const
+{
+    if (strategy != ShardStrategy::length) {
+        return all_shards;
+    }
+    // only these modes match entries with as many letters as the query
+    switch (mode) {
+    case ShardMode::search_any:
+        return Word(query, locale_name).length() % num_shards;
+    case ShardMode::letter_set:
+        return parse_letter_set_query(query, locale_name).position_masks.size() % num_shards;
+    default:
+        return all_shards;
+    }
+}
+
+static void append_size(std::string& message, size_t value)
+{
+    const auto fixed = static_cast<std::uint64_t>(value);
+    message.append(reinterpret_cast<const char*>(&fixed), sizeof(fixed));
+}
+
+static void append_string(std::string& message, std::string_view sw)
+{
+    append_size(message, sw.size());
+    message.append(sw);
+}
+
+// reads fields in the order they are appended
+class MessageReader {
+public:
+    explicit MessageReader(std::string_view message) noexcept
+        : message(message)
+    {
+    }
+
+    size_t read_size()
+    {
+        std::uint64_t fixed;
+        std::memcpy(&fixed, take(sizeof(fixed)).data(), sizeof(fixed));
+        return static_cast<size_t>(fixed);
+    }
+
+    std::string read_string()
+    {
+        const size_t size = read_size();
+        return std::string(take(size));
+    }
+
+private:
+    std::string_view take(size_t size)
+    {
+        if (message.size() < size) {
+            throw std::runtime_error("Shard message is truncated");
+        }
+        const std::string_view field = message.substr(0, size);
+        message.remove_prefix(size);
+        return field;
+    }
+
+    std::string_view message;
+};
+
+std::string encode_shard_request(const ShardRequest& request)
+{
+    std::string message;
+    append_string(message, request.query);
+    append_size(message, request.max_matches);
+    append_size(message, request.count_only);
+    append_size(message, static_cast<size_t>(request.limits.timeout.count()));
+    append_size(message, request.limits.max_candidates);
+    append_size(message, request.limits.max_results);
+    return message;
+}
+
+ShardRequest decode_shard_request(std::string_view message)
+{
+    MessageReader reader(message);
+    ShardRequest request;
+    request.query = reader.read_string();
+    request.max_matches = reader.read_size();
+    request.count_only = (reader.read_size() != 0);
+    request.limits.timeout = std::chrono::milliseconds(reader.read_size());
+    request.limits.max_candidates = reader.read_size();
+    request.limits.max_results = reader.read_size();
+    return request;
+}
+
+std::string encode_shard_response(const ShardResponse& response)
+{
+    std::string message;
+    append_string(message, response.error);
+    append_size(message, response.num_matches);
+    append_size(message, response.is_num_matches_exact);
+    append_string(message, response.truncation_reason);
+    append_size(message, response.matches.size());
+    for (const auto& [id, line] : response.matches) {
+        append_size(message, id);
+        append_string(message, line);
+    }
+    return message;
+}
+
+ShardResponse decode_shard_response(std::string_view message)
+{
+    MessageReader reader(message);
+    ShardResponse response;
+    response.error = reader.read_string();
+    response.num_matches = reader.read_size();
+    response.is_num_matches_exact = (reader.read_size() != 0);
+    response.truncation_reason = reader.read_string();
+    const size_t num_matches = reader.read_size();
+    for (size_t i = 0; i < num_matches; i++) {
+        const size_t id = reader.read_size();
+        response.matches.emplace_back(id, reader.read_string());
+    }
+    return response;
+}
+
+// lines of the speller file that belong to the shard, with their line indices
+static std::string read_shard_content(const std::filesystem::path& speller_path, const ShardLayout& layout, size_t shard_index, std::vector<size_t>& global_ids)
+{
+    if (!std::filesystem::exists(speller_path)) {
+        throw std::runtime_error("File does not exist: " + speller_path.string());
+    }
+    std::ifstream ifs(speller_path);
+    std::string content;
+    size_t id = 0;
+    for (std::string line; std::getline(ifs, line); id++) {
+        if (layout.get_shard_index(line) != shard_index) {
+            continue;
+        }
+        content += line;
+        content += '\n';
+        global_ids.push_back(id);
+    }
+    return content;
+}
+
+Shard::Shard(const std::filesystem::path& speller_path, const ShardLayout& layout, size_t shard_index, ShardMode mode)
+    : mode(mode)
+    , dictionary(EntryStore(read_shard_content(speller_path, layout, shard_index, global_ids)), layout.locale_name)
+{
+    // build only the index of the query mode
+    switch (mode) {
+    case ShardMode::search:
+        dictionary.get_key_index();
+        if (dictionary.uses_suffix_index()) {
+            dictionary.get_suffix_index();
+        }
+        dictionary.get_statistics();
+        break;
+    case ShardMode::search_any:
+        dictionary.get_anagram_index();
+        dictionary.get_statistics();
+        break;
+    case ShardMode::letter_set:
+        dictionary.get_letter_matrix();
+        dictionary.get_statistics();
+        break;
+    default:
+        break;
+    }
+}
+
+ShardResponse Shard::answer(const ShardRequest& request) const
+{
+    ShardResponse response;
+    try {
+        QueryBudget budget(request.limits);
+        ResultPage page(0, request.max_matches, request.count_only);
+        auto add_match = [this, &response](size_t id, std::string line) {
+            response.matches.emplace_back(global_ids[id], std::move(line));
+        };
+        switch (mode) {
+        case ShardMode::regex: {
+            const std::regex rgx = compile_regex(request.query);
+            for (const EntryHandle& handle : dictionary.search_regex(rgx, budget, page)) {
+                add_match(handle.id, std::string(handle.text));
+            }
+            break;
+        }
+        case ShardMode::search: {
+            for (const EntryHandle& handle : dictionary.match_wildcard(request.query, budget, page)) {
+                add_match(handle.id, to_lowercase(handle.text, dictionary.get_locale_name()));
+            }
+            break;
+        }
+        case ShardMode::search_any: {
+            const bool has_jokers = (request.query.find('?') != std::string::npos);
+            for (const AnagramMatch& match : dictionary.find_anagrams(request.query, budget, page)) {
+                add_match(match.entry_id, dictionary.format_anagram_match(match, has_jokers));
+            }
+            break;
+        }
+        case ShardMode::letter_set: {
+            const LetterSetQuery query = parse_letter_set_query(request.query, dictionary.get_locale_name());
+            for (size_t id : dictionary.find_letter_set(query, budget, page)) {
+                add_match(id, std::string(dictionary[id]));
+            }
+            break;
+        }
+        }
+        response.num_matches = page.get_num_matches();
+        response.is_num_matches_exact = page.is_num_matches_exact() && !budget.is_truncated();
+        if (budget.is_truncated()) {
+            response.truncation_reason = budget.get_truncation_reason();
+        }
+    } catch (const std::exception& e) {
+        response = ShardResponse();
+        response.error = e.what();
+    }
+    return response;
+}
+
+size_t Shard::size() const noexcept
+{
+    return dictionary.size();
+}
+
+} // namespace speller
@@ -0,0 +1,189 @@
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <regex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Headers
+#include <speller/anagram_index.hpp>
+#include <speller/dictionary.hpp>
+#include <speller/dictionary_snapshot.hpp>
+#include <speller/letter_matrix.hpp>
+#include <speller/letter_trie.hpp>
+#include <speller/live_snapshot.hpp>
+#include <speller/phrase_index.hpp>
+#include <speller/query_budget.hpp>
+#include <speller/result_page.hpp>
+#include <speller/search.hpp>
+#include <speller/utility.hpp>
+#include <speller/word.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char** argv)
+try {
+    // Split command line arguments
+    const util::Arguments arguments = util::parse_arguments(argc, argv);
+    const std::vector<std::string>& positional = arguments.positional;
+
+    // Obtain speller resource file path
+    speller::DictionaryFiles files;
+    files.speller_path = (positional.size() > 0) ? positional[0] : "tr.txt";
+    std::cout << "Speller filename: " << files.speller_path.string() << "\n";
+
+    // Obtain alphabet resource file, if specified
+    if (positional.size() > 1) {
+        // Print configuration
+        files.alphabet_path = positional[1];
+        files.locale_name = (positional.size() > 2) ? positional[2] : files.speller_path.stem().string();
+        std::cout << "Alphabet filename: " << files.alphabet_path.string() << "\n";
+        std::cout << "Locale: " << files.locale_name << std::endl;
+    }
+
+    // Obtain letter score resource file, if specified
+    const bool has_scores = (positional.size() > 3);
+    if (has_scores) {
+        files.scores_path = positional[3];
+        std::cout << "Scores filename: " << files.scores_path.string() << "\n";
+    }
+    std::cout << std::endl;
+
+    // Obtain query limits
+    speller::QueryLimits limits;
+    limits.timeout = std::chrono::milliseconds(util::get_option(arguments, "timeout-ms", limits.timeout.count()));
+    limits.max_candidates = util::get_option(arguments, "max-candidates", limits.max_candidates);
+    limits.max_results = util::get_option(arguments, "max-results", limits.max_results);
+
+    // Obtain result page
+    const size_t offset = util::get_option(arguments, "offset", size_t(0));
+    const size_t limit = util::get_option(arguments, "limit", speller::ResultPage::unlimited);
+    const bool count_only = util::has_option(arguments, "count-only");
+
+    // Watch resource files, if requested
+    const std::vector<std::filesystem::path> watched_paths = util::has_option(arguments, "watch") ? files.get_paths() : std::vector<std::filesystem::path>();
+
+    // Load resources, then gather statistics for planning queries,
+    // building indexes on first use, or those used before a reload
+    auto build_indexes = [](const speller::Dictionary& dictionary) {
+        dictionary.get_statistics();
+    };
+    const speller::LiveSnapshot<speller::DictionarySnapshot> live(speller::dictionary_snapshot_loader(files, build_indexes), watched_paths);
+
+    // Configure standard input
+    util::enable_exceptions(std::cin);
+    std::cin.tie(&std::cout);
+
+    // Configure standard output for matches
+    util::OutputBuffer output;
+
+    // Run in an infinite loop
+    size_t snapshot_version = 0;
+    size_t num_failures = 0;
+    while (true) {
+        // Report background reloads
+        if (live.get_version() != snapshot_version) {
+            snapshot_version = live.get_version();
+            std::cout << "Resources reloaded.\n";
+        }
+        if (live.get_num_failures() != num_failures) {
+            num_failures = live.get_num_failures();
+            std::cout << "Reload failed, using previous resources: " << live.get_last_error() << "\n";
+        }
+
+        // Obtain query mode and search string
+        std::cout << "Search: ";
+        std::string mode;
+        std::string search_str;
+        std::cin >> mode >> search_str;
+
+        // Use the same snapshot for the whole query
+        const std::shared_ptr<const speller::DictionarySnapshot> snapshot = live.get();
+        const speller::Dictionary& dictionary = snapshot->dictionary;
+
+        // Keep serving after an invalid query
+        try {
+            speller::QueryBudget budget(limits);
+            speller::ResultPage page(offset, limit, count_only);
+            auto print_summary = [&]() {
+                const char* const lower_bound_str = (page.is_num_matches_exact() && !budget.is_truncated()) ? "" : "at least ";
+                output << "A total of " << lower_bound_str << page.get_num_matches() << " matches found.\n";
+                if (budget.is_truncated()) {
+                    output << "Search truncated: " << budget.get_truncation_reason() << ".\n";
+                }
+            };
+
+            // Obtain and print matches in the same format as the executable of each mode
+            if (mode == "regex") {
+                const std::regex rgx = speller::compile_regex(search_str);
+                const std::vector<speller::EntryHandle> results = dictionary.search_regex(rgx, budget, page);
+                print_summary();
+                for (const speller::EntryHandle& res : results) {
+                    output << res.text << '\n';
+                }
+            } else if (mode == "search") {
+                const std::vector<speller::EntryHandle> results = dictionary.match_wildcard(search_str, budget, page);
+                print_summary();
+                for (const speller::EntryHandle& res : results) {
+                    output << speller::to_lowercase(res.text, dictionary.get_locale_name()) << '\n';
+                }
+            } else if (mode == "search_any") {
+                const bool has_jokers = (search_str.find('?') != std::string::npos);
+                const std::vector<speller::AnagramMatch> results = dictionary.find_anagrams(search_str, budget, page);
+                print_summary();
+                for (const speller::AnagramMatch& res : results) {
+                    output << dictionary.format_anagram_match(res, has_jokers) << '\n';
+                }
+            } else if (mode == "letter_set") {
+                const speller::LetterSetQuery query = speller::parse_letter_set_query(search_str, dictionary.get_locale_name());
+                const std::vector<size_t> results = dictionary.find_letter_set(query, budget, page);
+                print_summary();
+                for (size_t index : results) {
+                    output << dictionary[index] << '\n';
+                }
+            } else if (mode == "rack") {
+                const speller::RackQuery query = speller::parse_rack_query(search_str, dictionary.get_locale_name());
+                const std::vector<speller::RackMatch> results = dictionary.find_formable(query, snapshot->letter_scores, budget, page);
+                print_summary();
+                for (const speller::RackMatch& res : results) {
+                    output << dictionary.format_rack_match(res, has_scores, query.num_jokers != 0) << '\n';
+                }
+            } else if (mode == "phrase") {
+                const speller::PhraseQuery query = speller::parse_phrase_query(search_str);
+                const std::vector<size_t> results = dictionary.find_phrases(query, budget, page);
+                print_summary();
+                for (size_t index : results) {
+                    output << dictionary[index] << '\n';
+                }
+            } else if (mode == "substrings") {
+                const std::vector<std::vector<size_t>> matches = dictionary.find_substrings({ search_str }, budget);
+                std::vector<size_t> results;
+                for (size_t index : matches.front()) {
+                    if (page.take()) {
+                        results.push_back(index);
+                    }
+                }
+                print_summary();
+                for (size_t index : results) {
+                    output << dictionary[index] << '\n';
+                }
+            } else {
+                throw std::invalid_argument("Unknown mode: " + mode);
+            }
+        } catch (const std::exception& e) {
+            output << "Query failed: " << std::string_view(e.what()) << '\n';
+        }
+        output << '\n';
+        output.flush();
+    }
+} catch (const std::exception& e) {
+    // Print error and exit
+    std::cout << "Exception: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+}
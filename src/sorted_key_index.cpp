@@ -0,0 +1,164 @@
+#include <speller/sorted_key_index.hpp>
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <algorithm>
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <regex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Headers
+#include <speller/search.hpp>
+#include <speller/word.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+static void write_ids(std::ostream& os, const std::vector<std::uint32_t>& ids)
+{
+    const auto size = static_cast<std::uint64_t>(ids.size());
+    os.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    os.write(reinterpret_cast<const char*>(ids.data()), ids.size() * sizeof(std::uint32_t));
+}
+
+static std::vector<std::uint32_t> read_ids(std::istream& is)
+{
+    std::uint64_t size;
+    if (!is.read(reinterpret_cast<char*>(&size), sizeof(size)) || size > std::numeric_limits<std::uint32_t>::max() + std::uint64_t(1)) {
+        throw std::runtime_error("Sorted key index is corrupt");
+    }
+    std::vector<std::uint32_t> ids(static_cast<size_t>(size));
+    if (!is.read(reinterpret_cast<char*>(ids.data()), ids.size() * sizeof(std::uint32_t))) {
+        throw std::runtime_error("Sorted key index is truncated");
+    }
+    return ids;
+}
+
+SortedKeyIndex::SortedKeyIndex(const EntryStore& store, const std::string& locale_name, KeyDirection direction)
+{
+    if (store.size() > std::numeric_limits<std::uint32_t>::max()) {
+        throw std::length_error("Too many entries for a sorted key index");
+    }
+    // sort entries by their lowercase form, keeping entries with the same key in order
+    EntryStore lowercase_store = to_lowercase(store, locale_name);
+    if (direction == KeyDirection::reversed) {
+        std::string reversed_content;
+        reversed_content.reserve(lowercase_store.get_content().size());
+        for (size_t id = 0; id < lowercase_store.size(); id++) {
+            reversed_content += reverse_letters(lowercase_store[id], locale_name);
+            reversed_content += '\n';
+        }
+        lowercase_store = EntryStore(std::move(reversed_content));
+    }
+    std::vector<std::pair<std::string_view, std::uint32_t>> sorted_entries;
+    sorted_entries.reserve(lowercase_store.size());
+    for (size_t id = 0; id < lowercase_store.size(); id++) {
+        sorted_entries.emplace_back(lowercase_store[id], static_cast<std::uint32_t>(id));
+    }
+    std::sort(sorted_entries.begin(), sorted_entries.end());
+
+    // group identifiers by key
+    std::vector<std::string_view> distinct_keys;
+    entry_ids.reserve(sorted_entries.size());
+    for (const auto& [key, id] : sorted_entries) {
+        if (distinct_keys.empty() || distinct_keys.back() != key) {
+            distinct_keys.push_back(key);
+            id_offsets.push_back(static_cast<std::uint32_t>(entry_ids.size()));
+        }
+        entry_ids.push_back(id);
+    }
+    id_offsets.push_back(static_cast<std::uint32_t>(entry_ids.size()));
+    keys = FrontCodedStrings(distinct_keys);
+}
+
+SortedKeyIndex SortedKeyIndex::load(std::istream& is)
+{
+    SortedKeyIndex result;
+    result.keys = FrontCodedStrings::load(is);
+    result.id_offsets = read_ids(is);
+    result.entry_ids = read_ids(is);
+    // lookups trust the identifiers, so check their ranges once
+    const bool valid = result.id_offsets.size() == result.keys.size() + 1
+        && result.id_offsets.front() == 0
+        && result.id_offsets.back() == result.entry_ids.size()
+        && std::is_sorted(result.id_offsets.begin(), result.id_offsets.end())
+        && std::all_of(result.entry_ids.begin(), result.entry_ids.end(), [&result](std::uint32_t id) { return id < result.entry_ids.size(); });
+    if (!valid) {
+        throw std::runtime_error("Sorted key index is corrupt");
+    }
+    return result;
+}
+
+void SortedKeyIndex::save(std::ostream& os) const
+{
+    keys.save(os);
+    write_ids(os, id_offsets);
+    write_ids(os, entry_ids);
+    if (!os) {
+        throw std::runtime_error("Failed to write sorted key index");
+    }
+}
+
+const FrontCodedStrings& SortedKeyIndex::get_keys() const& noexcept
+{
+    return keys;
+}
+
+void SortedKeyIndex::append_entry_ids(size_t key_index, std::vector<size_t>& ids) const
+{
+    ids.insert(ids.end(), entry_ids.begin() + id_offsets.at(key_index), entry_ids.begin() + id_offsets.at(key_index + 1));
+}
+
+std::vector<size_t> SortedKeyIndex::find(std::string_view key) const
+{
+    std::vector<size_t> results;
+    const size_t key_index = keys.find(key);
+    if (key_index != FrontCodedStrings::npos) {
+        append_entry_ids(key_index, results);
+    }
+    return results;
+}
+
+std::vector<size_t> SortedKeyIndex::find_prefix(std::string_view prefix) const
+{
+    const auto [begin, end] = keys.find_prefix(prefix);
+    std::vector<size_t> results(entry_ids.begin() + id_offsets[begin], entry_ids.begin() + id_offsets[end]);
+    std::sort(results.begin(), results.end());
+    return results;
+}
+
+size_t SortedKeyIndex::count_prefix(std::string_view prefix) const
+{
+    const auto [begin, end] = keys.find_prefix(prefix);
+    return id_offsets[end] - id_offsets[begin];
+}
+
+std::vector<size_t> SortedKeyIndex::match(const std::regex& rgx, std::string_view literal_prefix, QueryBudget& budget) const
+{
+    const auto [begin, end] = keys.find_prefix(literal_prefix);
+    std::vector<size_t> results;
+    keys.for_each(begin, end, [&](size_t key_index, std::string_view key) {
+        if (!budget.visit_expensive_candidate()) {
+            return false;
+        }
+        if (std::regex_match(key.begin(), key.end(), rgx)) {
+            append_entry_ids(key_index, results);
+        }
+        return true;
+    });
+    std::sort(results.begin(), results.end());
+    return results;
+}
+
+size_t SortedKeyIndex::get_memory_size() const noexcept
+{
+    return keys.get_memory_size() + (id_offsets.capacity() + entry_ids.capacity()) * sizeof(std::uint32_t);
+}
+
+} // namespace speller
@@ -0,0 +1,159 @@
+#include <speller/substring_automaton.hpp>
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Headers
+#include <speller/locale.hpp>
+#include <speller/word.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+SubstringAutomaton::SubstringAutomaton(const std::vector<std::string>& patterns, std::string locale_name_value)
+    : locale_name(std::move(locale_name_value))
+    , alphabet(&Locale(locale_name).get_alphabet())
+    , num_patterns(patterns.size())
+{
+    if (patterns.size() > std::numeric_limits<std::uint32_t>::max()) {
+        throw std::length_error("Too many substring patterns");
+    }
+
+    // split patterns into symbols, numbering letters outside the alphabet as they appear
+    std::vector<std::vector<std::uint32_t>> pattern_symbols;
+    pattern_symbols.reserve(patterns.size());
+    for (const std::string& pattern : patterns) {
+        const Word word(pattern, locale_name);
+        if (word.length() == 0) {
+            throw std::invalid_argument("Substring pattern is empty");
+        }
+        std::vector<std::uint32_t>& symbols = pattern_symbols.emplace_back();
+        for (size_t i = 0; i < word.length(); i++) {
+            const Letter letter = word[i];
+            const LetterId id = alphabet->get_letter_id(letter);
+            if (id != Alphabet::foreign_letter_id) {
+                symbols.push_back(id);
+                continue;
+            }
+            const auto next_symbol = static_cast<std::uint32_t>(alphabet->size() + foreign_symbols.size());
+            symbols.push_back(foreign_symbols.try_emplace(std::string(letter.string_view()), next_symbol).first->second);
+        }
+    }
+    num_symbols = alphabet->size() + foreign_symbols.size();
+
+    // insert patterns into a trie, whose missing transitions are filled in afterwards
+    constexpr std::uint32_t missing = std::numeric_limits<std::uint32_t>::max();
+    transitions.assign(num_symbols, missing);
+    std::vector<std::vector<std::uint32_t>> state_patterns(1);
+    for (size_t index = 0; index < patterns.size(); index++) {
+        size_t state = 0;
+        for (std::uint32_t symbol : pattern_symbols[index]) {
+            const size_t transition = state * num_symbols + symbol;
+            if (transitions[transition] == missing) {
+                if (state_patterns.size() == missing) {
+                    throw std::length_error("Too many states for a substring automaton");
+                }
+                transitions[transition] = static_cast<std::uint32_t>(state_patterns.size());
+                transitions.resize(transitions.size() + num_symbols, missing);
+                state_patterns.emplace_back();
+            }
+            state = transitions[transition];
+        }
+        state_patterns[state].push_back(static_cast<std::uint32_t>(index));
+    }
+
+    // visit states in breadth-first order, so that the failure of each state is complete before its children
+    const size_t num_states = state_patterns.size();
+    std::vector<std::uint32_t> failures(num_states, 0);
+    output_links.assign(num_states, 0);
+    std::vector<std::uint32_t> queue;
+    queue.reserve(num_states);
+    for (size_t symbol = 0; symbol < num_symbols; symbol++) {
+        if (transitions[symbol] == missing) {
+            transitions[symbol] = 0;
+        } else {
+            queue.push_back(transitions[symbol]);
+        }
+    }
+    for (size_t i = 0; i < queue.size(); i++) {
+        const size_t state = queue[i];
+        for (size_t symbol = 0; symbol < num_symbols; symbol++) {
+            const std::uint32_t fallback = transitions[failures[state] * num_symbols + symbol];
+            std::uint32_t& next = transitions[state * num_symbols + symbol];
+            if (next == missing) {
+                next = fallback;
+                continue;
+            }
+            failures[next] = fallback;
+            output_links[next] = state_patterns[fallback].empty() ? output_links[fallback] : fallback;
+            queue.push_back(next);
+        }
+    }
+
+    // flatten patterns of each state
+    output_offsets.reserve(num_states + 1);
+    output_patterns.reserve(patterns.size());
+    for (const std::vector<std::uint32_t>& indices : state_patterns) {
+        output_offsets.push_back(static_cast<std::uint32_t>(output_patterns.size()));
+        output_patterns.insert(output_patterns.end(), indices.begin(), indices.end());
+    }
+    output_offsets.push_back(static_cast<std::uint32_t>(output_patterns.size()));
+}
+
+size_t SubstringAutomaton::get_num_patterns() const noexcept
+{
+    return num_patterns;
+}
+
+size_t SubstringAutomaton::get_num_states() const noexcept
+{
+    return output_links.size();
+}
+
+std::vector<std::vector<size_t>> SubstringAutomaton::find_all(const EntryStore& store, QueryBudget& budget) const
+{
+    std::vector<std::vector<size_t>> results(num_patterns);
+    // last entry that reported the patterns of each state, so that each pattern is reported once per entry
+    constexpr size_t not_reported = static_cast<size_t>(-1);
+    std::vector<size_t> reported(get_num_states(), not_reported);
+    for (size_t id = 0; id < store.size(); id++) {
+        if (!budget.visit_candidates()) {
+            break;
+        }
+        const Word word(std::string(store[id]), locale_name);
+        size_t state = 0;
+        for (size_t i = 0; i < word.length(); i++) {
+            const std::uint32_t symbol = get_symbol(word[i]);
+            state = (symbol == no_symbol) ? 0 : transitions[state * num_symbols + symbol];
+            // states further along the output links were reported together with the first reported one
+            size_t output = (output_offsets[state] != output_offsets[state + 1]) ? state : output_links[state];
+            for (; output != 0 && reported[output] != id; output = output_links[output]) {
+                reported[output] = id;
+                for (size_t k = output_offsets[output]; k < output_offsets[output + 1]; k++) {
+                    if (!budget.add_result()) {
+                        return results;
+                    }
+                    results[output_patterns[k]].push_back(id);
+                }
+            }
+        }
+    }
+    return results;
+}
+
+std::uint32_t SubstringAutomaton::get_symbol(Letter letter) const
+{
+    const LetterId id = alphabet->get_letter_id(letter);
+    if (id != Alphabet::foreign_letter_id) {
+        return id;
+    }
+    const auto it = foreign_symbols.find(std::string(letter.string_view()));
+    return (it == foreign_symbols.end()) ? no_symbol : it->second;
+}
+
+} // namespace speller
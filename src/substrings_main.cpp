@@ -0,0 +1,111 @@
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Headers
+#include <speller/alphabet.hpp>
+#include <speller/dictionary.hpp>
+#include <speller/entry_store.hpp>
+#include <speller/locale.hpp>
+#include <speller/query_budget.hpp>
+#include <speller/result_page.hpp>
+#include <speller/utility.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char** argv)
+try {
+    // Split command line arguments
+    const util::Arguments arguments = util::parse_arguments(argc, argv);
+    const std::vector<std::string>& positional = arguments.positional;
+
+    // Obtain speller resource file path
+    const std::filesystem::path speller_path = (positional.size() > 0) ? positional[0] : "tr.txt";
+    std::cout << "Speller filename: " << speller_path.string() << "\n";
+
+    // Obtain alphabet resource file, if specified
+    std::string locale_name = speller::Locale::default_locale_name;
+    if (positional.size() > 1) {
+        // Print configuration
+        const std::string alphabet_filename = positional[1];
+        locale_name = (positional.size() > 2) ? positional[2] : speller_path.stem().string();
+        std::cout << "Alphabet filename: " << alphabet_filename << "\n";
+        std::cout << "Locale: " << locale_name << std::endl;
+        // Add locale
+        speller::Alphabet alphabet = speller::alphabet_from_file(alphabet_filename);
+        locale_name = speller::Locale::add_unique_locale(locale_name, std::move(alphabet));
+    }
+    std::cout << std::endl;
+
+    // Obtain query limits
+    speller::QueryLimits limits;
+    limits.timeout = std::chrono::milliseconds(util::get_option(arguments, "timeout-ms", limits.timeout.count()));
+    limits.max_candidates = util::get_option(arguments, "max-candidates", limits.max_candidates);
+    limits.max_results = util::get_option(arguments, "max-results", limits.max_results);
+
+    // Obtain result page of each query
+    const size_t offset = util::get_option(arguments, "offset", size_t(0));
+    const size_t limit = util::get_option(arguments, "limit", speller::ResultPage::unlimited);
+    const bool count_only = util::has_option(arguments, "count-only");
+
+    // Read queries line by line, from standard input unless a file is given
+    std::vector<std::string> lines;
+    if (util::has_option(arguments, "queries")) {
+        lines = util::file_to_vector(util::get_option(arguments, "queries", std::string()));
+    } else {
+        for (std::string line; std::getline(std::cin, line);) {
+            lines.push_back(std::move(line));
+        }
+    }
+    std::vector<std::string> queries;
+    for (std::string& line : lines) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (!line.empty()) {
+            queries.push_back(std::move(line));
+        }
+    }
+
+    // Read speller content
+    const speller::Dictionary dictionary(speller::EntryStore::from_file(speller_path), locale_name);
+
+    // Match every query in a single pass over the entries
+    speller::QueryBudget budget(limits);
+    const std::vector<std::vector<size_t>> results = dictionary.find_substrings(queries, budget);
+
+    // Configure standard output for matches
+    util::OutputBuffer output;
+
+    // Print matches of each query in order
+    for (size_t index = 0; index < queries.size(); index++) {
+        speller::ResultPage page(offset, limit, count_only);
+        std::vector<size_t> ids;
+        for (size_t id : results[index]) {
+            if (page.take()) {
+                ids.push_back(id);
+            }
+        }
+        const char* const lower_bound_str = budget.is_truncated() ? "at least " : "";
+        output << "Search: " << queries[index] << '\n';
+        output << "A total of " << lower_bound_str << page.get_num_matches() << " matches found.\n";
+        if (budget.is_truncated()) {
+            output << "Search truncated: " << budget.get_truncation_reason() << ".\n";
+        }
+        for (size_t id : ids) {
+            output << dictionary[id] << '\n';
+        }
+        output << '\n';
+    }
+    output.flush();
+    return EXIT_SUCCESS;
+} catch (const std::exception& e) {
+    // Print error and exit
+    std::cout << "Exception: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,265 @@
+#include <speller/utf8.hpp>
+////////////////////////////////////////////////////////////////////////////////
+// Standard Headers
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+////////////////////////////////////////////////////////////////////////////////
+// System Headers
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SPELLER_HAS_SSE2
+#endif
+////////////////////////////////////////////////////////////////////////////////
+
+namespace speller {
+
+// whether the block of characters starting at @a data has no character above ASCII
+// the block is 32 (AVX2), 16 (SSE2) or 8 characters long
+#if defined(__AVX2__)
+static constexpr size_t ascii_block_size = sizeof(__m256i);
+
+static bool is_ascii_block(const char* data) noexcept
+{
+    const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+    return _mm256_movemask_epi8(block) == 0;
+}
+#elif defined(SPELLER_HAS_SSE2)
+static constexpr size_t ascii_block_size = sizeof(__m128i);
+
+static bool is_ascii_block(const char* data) noexcept
+{
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+    return _mm_movemask_epi8(block) == 0;
+}
+#else
+static constexpr size_t ascii_block_size = sizeof(std::uint64_t);
+
+static bool is_ascii_block(const char* data) noexcept
+{
+    std::uint64_t block;
+    std::memcpy(&block, data, sizeof(block));
+    return (block & 0x8080808080808080ull) == 0;
+}
+#endif
+
+size_t get_ascii_prefix_size(std::string_view sw) noexcept
+{
+    const char* const data = sw.data();
+    const size_t size = sw.size();
+    size_t offset = 0;
+    // a block with any high bit set is left to the exact search below
+    while (offset + ascii_block_size <= size && is_ascii_block(data + offset)) {
+        offset += ascii_block_size;
+    }
+    while (offset < size && static_cast<unsigned char>(data[offset]) < 0x80) {
+        offset++;
+    }
+    return offset;
+}
+
+bool is_ascii(std::string_view sw) noexcept
+{
+    return get_ascii_prefix_size(sw) == sw.size();
+}
+
+// size of the valid sequence at the start of a nonempty string, zero if invalid
+static size_t get_valid_sequence_size(std::string_view rest) noexcept
+{
+    auto at = [&rest](size_t i) { return static_cast<unsigned char>(rest[i]); };
+    auto is_continuation = [](unsigned char byte) { return (byte & 0xC0) == 0x80; };
+    const unsigned char lead = at(0);
+    size_t size;
+    // bounds of the second character exclude overlong forms, surrogates and values above U+10FFFF
+    unsigned char second_min = 0x80;
+    unsigned char second_max = 0xBF;
+    if (lead < 0x80) {
+        return 1;
+    } else if (lead < 0xC2) {
+        return 0;
+    } else if (lead < 0xE0) {
+        size = 2;
+    } else if (lead < 0xF0) {
+        size = 3;
+        second_min = (lead == 0xE0) ? 0xA0 : 0x80;
+        second_max = (lead == 0xED) ? 0x9F : 0xBF;
+    } else if (lead < 0xF5) {
+        size = 4;
+        second_min = (lead == 0xF0) ? 0x90 : 0x80;
+        second_max = (lead == 0xF4) ? 0x8F : 0xBF;
+    } else {
+        return 0;
+    }
+    if (rest.size() < size || at(1) < second_min || at(1) > second_max) {
+        return 0;
+    }
+    for (size_t i = 2; i < size; i++) {
+        if (!is_continuation(at(i))) {
+            return 0;
+        }
+    }
+    return size;
+}
+
+#if defined(__AVX2__)
+// vectorized validation of Keiser and Lemire, "Validating UTF-8 In Less Than One Instruction Per Byte"
+// each error kind is a bit, set when a pair of adjacent characters may cause it
+static constexpr std::uint8_t too_short = 1 << 0;
+static constexpr std::uint8_t too_long = 1 << 1;
+static constexpr std::uint8_t overlong_3 = 1 << 2;
+static constexpr std::uint8_t too_large = 1 << 3;
+static constexpr std::uint8_t surrogate = 1 << 4;
+static constexpr std::uint8_t overlong_2 = 1 << 5;
+static constexpr std::uint8_t too_large_1000 = 1 << 6;
+static constexpr std::uint8_t overlong_4 = 1 << 6;
+static constexpr std::uint8_t two_continuations = 1 << 7;
+static constexpr std::uint8_t carry = too_short | too_long | two_continuations;
+
+// indexed by the high nibble of the first character
+alignas(16) static constexpr std::uint8_t first_high_nibble_errors[16] = {
+    too_long, too_long, too_long, too_long, too_long, too_long, too_long, too_long,
+    two_continuations, two_continuations, two_continuations, two_continuations,
+    too_short | overlong_2,
+    too_short,
+    too_short | overlong_3 | surrogate,
+    too_short | too_large | too_large_1000 | overlong_4
+};
+
+// indexed by the low nibble of the first character
+alignas(16) static constexpr std::uint8_t first_low_nibble_errors[16] = {
+    carry | overlong_3 | overlong_2 | overlong_4,
+    carry | overlong_2,
+    carry,
+    carry,
+    carry | too_large,
+    carry | too_large | too_large_1000,
+    carry | too_large | too_large_1000,
+    carry | too_large | too_large_1000,
+    carry | too_large | too_large_1000,
+    carry | too_large | too_large_1000,
+    carry | too_large | too_large_1000,
+    carry | too_large | too_large_1000,
+    carry | too_large | too_large_1000,
+    carry | too_large | too_large_1000 | surrogate,
+    carry | too_large | too_large_1000,
+    carry | too_large | too_large_1000
+};
+
+// indexed by the high nibble of the second character
+alignas(16) static constexpr std::uint8_t second_high_nibble_errors[16] = {
+    too_short, too_short, too_short, too_short, too_short, too_short, too_short, too_short,
+    too_long | overlong_2 | two_continuations | overlong_3 | too_large_1000 | overlong_4,
+    too_long | overlong_2 | two_continuations | overlong_3 | too_large,
+    too_long | overlong_2 | two_continuations | surrogate | too_large,
+    too_long | overlong_2 | two_continuations | surrogate | too_large,
+    too_short, too_short, too_short, too_short
+};
+
+static __m256i lookup_nibbles(const std::uint8_t* table, __m256i nibbles) noexcept
+{
+    const __m128i half = _mm_load_si128(reinterpret_cast<const __m128i*>(table));
+    return _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(half), nibbles);
+}
+
+// characters of the current block, each preceded by the character count positions before
+template <int count>
+static __m256i get_preceding(__m256i input, __m256i previous_input) noexcept
+{
+    const __m256i joined = _mm256_permute2x128_si256(previous_input, input, 0x21);
+    return _mm256_alignr_epi8(input, joined, 16 - count);
+}
+
+// nonzero where a character of the block is invalid, considering the end of the previous block
+static __m256i get_block_errors(__m256i input, __m256i previous_input) noexcept
+{
+    const __m256i low_nibble_mask = _mm256_set1_epi8(0x0F);
+    auto get_high_nibbles = [&low_nibble_mask](__m256i v) {
+        return _mm256_and_si256(_mm256_srli_epi16(v, 4), low_nibble_mask);
+    };
+    const __m256i previous1 = get_preceding<1>(input, previous_input);
+    const __m256i special_cases = _mm256_and_si256(
+        _mm256_and_si256(lookup_nibbles(first_high_nibble_errors, get_high_nibbles(previous1)),
+            lookup_nibbles(first_low_nibble_errors, _mm256_and_si256(previous1, low_nibble_mask))),
+        lookup_nibbles(second_high_nibble_errors, get_high_nibbles(input)));
+    // third and fourth characters of sequences must be continuations
+    const __m256i is_third = _mm256_subs_epu8(get_preceding<2>(input, previous_input), _mm256_set1_epi8(0xE0 - 0x80));
+    const __m256i is_fourth = _mm256_subs_epu8(get_preceding<3>(input, previous_input), _mm256_set1_epi8(0xF0 - 0x80));
+    const __m256i must_be_continuation = _mm256_and_si256(_mm256_or_si256(is_third, is_fourth), _mm256_set1_epi8(static_cast<char>(0x80)));
+    return _mm256_xor_si256(must_be_continuation, special_cases);
+}
+
+// start of a code point, before which every character is known to be valid
+static size_t get_checked_prefix_size(std::string_view sw) noexcept
+{
+    const char* const data = sw.data();
+    const size_t size = sw.size();
+    __m256i previous_input = _mm256_setzero_si256();
+    size_t offset = 0;
+    for (; offset + sizeof(__m256i) <= size; offset += sizeof(__m256i)) {
+        const __m256i input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + offset));
+        const __m256i errors = get_block_errors(input, previous_input);
+        if (!_mm256_testz_si256(errors, errors)) {
+            break;
+        }
+        previous_input = input;
+    }
+    // an error or an incomplete sequence may start in the previous block
+    size_t checked = (offset >= sizeof(__m256i)) ? offset - sizeof(__m256i) : 0;
+    while (checked > 0 && (static_cast<unsigned char>(data[checked]) & 0xC0) == 0x80) {
+        checked--;
+    }
+    return checked;
+}
+#endif
+
+size_t find_invalid_utf8(std::string_view sw) noexcept
+{
+    const char* const data = sw.data();
+    const size_t size = sw.size();
+    size_t offset = 0;
+#if defined(__AVX2__)
+    // locate the exact error and check the last block one sequence at a time
+    offset = get_checked_prefix_size(sw);
+#endif
+    while (offset < size) {
+        // skip whole ASCII blocks
+        if (offset + ascii_block_size <= size && is_ascii_block(data + offset)) {
+            offset += ascii_block_size;
+            continue;
+        }
+        // validate the rest of the block one sequence at a time
+        const size_t block_end = std::min(offset + ascii_block_size, size);
+        while (offset < block_end) {
+            if (static_cast<unsigned char>(data[offset]) < 0x80) {
+                offset++;
+                continue;
+            }
+            const size_t sequence_size = get_valid_sequence_size(sw.substr(offset));
+            if (sequence_size == 0) {
+                return offset;
+            }
+            offset += sequence_size;
+        }
+    }
+    return size;
+}
+
+void validate_utf8(std::string_view sw)
+{
+    const size_t offset = find_invalid_utf8(sw);
+    if (offset == sw.size()) {
+        return;
+    }
+    const std::string_view before = sw.substr(0, offset);
+    const size_t line = std::count(before.begin(), before.end(), '\n') + 1;
+    const std::string_view::size_type line_start = before.rfind('\n');
+    const size_t byte = offset - ((line_start == std::string_view::npos) ? 0 : line_start + 1) + 1;
+    throw std::invalid_argument("Invalid UTF-8 on line " + std::to_string(line) + " at byte " + std::to_string(byte));
+}
+
+} // namespace speller
@@ -1,66 +1,119 @@
 #include <speller/word.hpp>
 ////////////////////////////////////////////////////////////////////////////////
 // Standard Headers
+#include <algorithm>
+#include <stdexcept>
+#include <string>
 #include <string_view>
+#include <vector>
 ////////////////////////////////////////////////////////////////////////////////
 // User Defined Headers
 #include <speller/alphabet.hpp>
 #include <speller/letter.hpp>
 #include <speller/locale.hpp>
+#include <speller/utf8.hpp>
 ////////////////////////////////////////////////////////////////////////////////
 
 namespace speller {
 
-Word::Word(std::string str_value, std::string locale_name_value)
-    : str(std::move(str_value))
-    , locale_name(std::move(locale_name_value))
+using Encoding = Alphabet::Encoding;
+
+// number of characters in the letter at the start of a nonempty valid UTF-8 string
+// a code point that is not in the alphabet counts as a letter on its own
+template <Encoding encoding>
+static size_t get_letter_size(const Alphabet& alphabet, std::string_view rest) noexcept
 {
-    // create locale object
-    const Locale locale(locale_name);
-    // obtain letters in current locale
-    const std::set<Letter>& all_letters = locale.get_alphabet().get_all_letters();
-    // calculate maximum possible character size of a letter
-    const size_t max_letter_size = get_max_letter_size(all_letters);
-    // string start point
-    const char* const begin_ptr = str.c_str();
-    // covered length in string
-    size_t current_total_len = 0;
-    // uncovered start point in string
-    auto get_ch_ptr = [&begin_ptr, &current_total_len]() {
-        return begin_ptr + current_total_len;
-    };
-    // add letter and cover the length
-    auto emplace = [this, &current_total_len](std::string_view sw) {
-        letters.emplace_back(sw);
-        current_total_len += sw.length();
-    };
-    // run until all string is covered
-    while (current_total_len != str.length()) {
-        // check whether a letter exists at current position
-        bool letter_found = false;
+    if constexpr (encoding == Encoding::generic) {
         // no need to exceed maximum letter length for searching
-        for (size_t len = 1; len <= max_letter_size; len++) {
-            // letter candidate
-            const std::string_view sw(get_ch_ptr(), len);
-            // check whether the candidate is a letter
-            if (all_letters.count(sw)) {
-                letter_found = true;
-                emplace(sw);
-                break;
+        const size_t max_size = std::min(alphabet.get_max_letter_size(), rest.size());
+        for (size_t size = 1; size <= max_size; size++) {
+            if (alphabet.get_letter_id(rest.substr(0, size)) != Alphabet::foreign_letter_id) {
+                return size;
+            }
+        }
+    }
+    // every code point is a letter on its own
+    return get_utf8_sequence_size(rest.front());
+}
+
+template <Encoding encoding>
+static void split_letters(const Alphabet& alphabet, std::string_view str, std::vector<size_t>& letter_offsets)
+{
+    letter_offsets.reserve(str.size() + 1);
+    size_t offset = 0;
+    while (offset < str.size()) {
+        if constexpr (encoding != Encoding::generic) {
+            // every ASCII character is a letter on its own
+            const size_t end = offset + get_ascii_prefix_size(str.substr(offset));
+            for (; offset < end; offset++) {
+                letter_offsets.push_back(offset);
             }
-            // bounds check
-            bool end_of_string = (current_total_len + len == str.length());
-            if (end_of_string) [[unlikely]] {
+            if (offset == str.size()) {
                 break;
             }
         }
-        // no letter exists at current position
-        // add unknown character to letters
-        if (!letter_found) {
-            const std::string_view sw(get_ch_ptr(), 1);
-            emplace(sw);
+        letter_offsets.push_back(offset);
+        offset += get_letter_size<encoding>(alphabet, str.substr(offset));
+    }
+    letter_offsets.push_back(str.size());
+}
+
+template <Encoding encoding, bool uppercase>
+static std::string convert_case(const Alphabet& alphabet, std::string_view str)
+{
+    std::string result;
+    if constexpr (encoding == Encoding::single_byte) {
+        // pure table lookups, since characters of multi-byte code points map to themselves
+        result.resize(str.size());
+        std::transform(str.begin(), str.end(), result.begin(), [&alphabet](char ch) {
+            return uppercase ? alphabet.toupper_byte(ch) : alphabet.tolower_byte(ch);
+        });
+    } else {
+        // converted letters may differ in size
+        result.reserve(str.size());
+        for (size_t offset = 0; offset < str.size();) {
+            const size_t size = get_letter_size<encoding>(alphabet, str.substr(offset));
+            const Letter letter = str.substr(offset, size);
+            result += (uppercase ? alphabet.toupper(letter) : alphabet.tolower(letter)).string_view();
+            offset += size;
         }
     }
+    return result;
+}
+
+template <bool uppercase>
+static std::string convert_case(const Alphabet& alphabet, std::string_view str)
+{
+    switch (alphabet.get_encoding()) {
+    case Encoding::single_byte:
+        return convert_case<Encoding::single_byte, uppercase>(alphabet, str);
+    case Encoding::utf8:
+        return convert_case<Encoding::utf8, uppercase>(alphabet, str);
+    default:
+        return convert_case<Encoding::generic, uppercase>(alphabet, str);
+    }
+}
+
+Word::Word(std::string str_value, std::string locale_name_value)
+    : str(std::move(str_value))
+    , locale_name(std::move(locale_name_value))
+    , alphabet(&Locale(locale_name).get_alphabet())
+{
+    validate_utf8(str);
+    // every character is a letter for single character alphabets and ASCII strings
+    switch (alphabet->get_encoding()) {
+    case Encoding::single_byte:
+        if (!is_ascii(str)) {
+            split_letters<Encoding::single_byte>(*alphabet, str, letter_offsets);
+        }
+        break;
+    case Encoding::utf8:
+        split_letters<Encoding::utf8>(*alphabet, str, letter_offsets);
+        break;
+    default:
+        split_letters<Encoding::generic>(*alphabet, str, letter_offsets);
+        break;
+    }
 }
 
 Word::operator const std::string&() const& noexcept
@@ -70,55 +123,56 @@ Word::operator const std::string&() const& noexcept
 
 size_t Word::length() const noexcept
 {
-    return letters.size();
+    return letter_offsets.empty() ? str.length() : letter_offsets.size() - 1;
 }
 
 Letter Word::operator[](size_t index) const&
 {
-    return letters[index];
+    if (letter_offsets.empty()) {
+        return std::string_view(str).substr(index, 1);
+    }
+    return std::string_view(str).substr(letter_offsets[index], letter_offsets[index + 1] - letter_offsets[index]);
 }
 
 Letter Word::at(size_t index) const&
 {
-    return letters.at(index);
+    if (index >= length()) {
+        throw std::out_of_range("Letter index is out of range: " + std::to_string(index));
+    }
+    return (*this)[index];
 }
 
 Word Word::tolower() const
 {
-    // create locale object
-    const Locale locale(locale_name);
-    // create alphabet object
-    const Alphabet& alphabet = locale.get_alphabet();
-    // calculate maximum possible character size of a lowercase letter
-    const size_t max_lowercase_letter_size = get_max_letter_size(alphabet.get_lowercase_letters());
-    // allocate maximum possible space required beforehand
-    std::string lower_str;
-    lower_str.reserve(letters.size() * max_lowercase_letter_size);
-    // convert letters to lowercase
-    for (Letter letter : letters) {
-        Letter lower_letter = alphabet.tolower(letter);
-        lower_str += lower_letter.string();
-    }
-    return Word(lower_str, locale_name);
+    return Word(convert_case<false>(*alphabet, str), locale_name);
 }
 
 Word Word::toupper() const
 {
-    // create locale object
-    const Locale locale(locale_name);
-    // create alphabet object
-    const Alphabet& alphabet = locale.get_alphabet();
-    // calculate maximum possible character size of an uppercase letter
-    const size_t max_uppercase_letter_size = get_max_letter_size(alphabet.get_uppercase_letters());
-    // allocate maximum possible space required beforehand
-    std::string upper_str;
-    upper_str.reserve(letters.size() * max_uppercase_letter_size);
-    // convert letters to uppercase
-    for (Letter letter : letters) {
-        Letter upper_letter = alphabet.toupper(letter);
-        upper_str += upper_letter.string();
+    return Word(convert_case<true>(*alphabet, str), locale_name);
+}
+
+std::string to_lowercase(std::string_view str, const std::string& locale_name)
+{
+    validate_utf8(str);
+    return convert_case<false>(Locale(locale_name).get_alphabet(), str);
+}
+
+std::string to_uppercase(std::string_view str, const std::string& locale_name)
+{
+    validate_utf8(str);
+    return convert_case<true>(Locale(locale_name).get_alphabet(), str);
+}
+
+std::string reverse_letters(std::string_view str, const std::string& locale_name)
+{
+    const Word word(std::string(str), locale_name);
+    std::string result;
+    result.reserve(str.size());
+    for (size_t index = word.length(); index > 0; index--) {
+        result += word[index - 1].string_view();
     }
-    return Word(upper_str, locale_name);
+    return result;
 }
 
 } // namespace speller